@@ -0,0 +1,945 @@
+/*******************************************************************************
+ * Forecast icons pre-blended onto the panel color - generated by
+ * scripts/resize_images.py, do not edit
+ ******************************************************************************/
+
+#include "lvgl.h"
+
+/* Panel color the icons were blended onto, read by scripts/build_assets.py */
+#define ICON_PANEL_BLEND_COLOR 0x5e9bc8
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_blizzard_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x3a,0xae,0x79,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x18,0x75,0x18,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x1a,0xa6,0xfb,0xde,0xdb,0xd6,0x79,0x7d,0xf8,0x64,0x58,0x85,0x78,0x8d,0x57,0x8d,0x58,0x85,0xf8,0x64,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x79,0x7d,0xdb,0xd6,0x1a,0xae,0xd8,0x5c,0x58,0x8d,0xd7,0xad,0xd7,0xad,0x58,0x8d,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x79,0x7d,0x9a,0x85,0x9a,0x85,0x9a,0x85,0x9a,0x85,0x9a,0x85,0x9a,0x85,0xfa,0x9d,0xfb,0xde,0xfa,0xa5,0xf8,0x64,0x77,0x95,0xb7,0xa5,0xb7,0xa5,0x77,0x95,0xf8,0x64,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xbb,0xc6,0x3c,0xe7,0x3c,0xe7,0x1c,0xe7,0x1c,0xe7,0x1c,0xe7,0x1c,0xe7,0xfb,0xde,0x7b,0xbe,0x19,0x6d,0xd8,0x5c,0xf8,0x6c,0x38,0x85,0x38,0x85,0xf8,0x6c,0xd8,0x64,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x9a,0x85,0xba,0x8d,0xba,0x8d,0xba,0x8d,0xba,0x8d,0xba,0x8d,0xba,0x8d,0x9a,0x85,0x19,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x18,0x6d,0x18,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0x5a,0xb6,0x9b,0xc6,0x9b,0xc6,0x9b,0xc6,0x9b,0xc6,0x9b,0xc6,0x9b,0xc6,0x9b,0xc6,0x9b,0xc6,0x9b,0xc6,0x9b,0xc6,0x9b,0xc6,0x9b,0xc6,0x7b,0xbe,0xfa,0xa5,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0x3a,0xb6,0x9b,0xc6,0x9b,0xc6,0x9b,0xc6,0x9b,0xc6,0x9b,0xc6,0x9b,0xc6,0x9b,0xc6,0x9b,0xc6,0x9b,0xc6,0x9b,0xc6,0x9b,0xc6,0x9b,0xc6,0x9b,0xc6,0x1c,0xe7,0x1a,0xa6,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x9a,0x85,0xba,0x8d,0xba,0x8d,0x9a,0x8d,0x39,0x75,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x18,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x9b,0xc6,0x9b,0xc6,0xf9,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0x9b,0xc6,0x1c,0xe7,0x1c,0xe7,0x1c,0xe7,0xbb,0xce,0x79,0x7d,0xd8,0x5c,0x18,0x6d,0x18,0x75,0x77,0x95,0xf8,0x6c,0xf8,0x64,0x39,0x75,0x1a,0xa6,0xdb,0xd6,0x5b,0xb6,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x59,0x7d,0x79,0x85,0x79,0x85,0xba,0x8d,0xdb,0xd6,0x5b,0xbe,0xf9,0x64,0x58,0x8d,0xb8,0xad,0xb7,0xad,0x77,0x95,0xf8,0x6c,0xba,0x8d,0xfb,0xde,0x9b,0xc6,0x39,0x75,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x6d,0x9b,0xc6,0x9b,0xc6,0xf9,0x64,0x38,0x7d,0xb7,0xad,0xd7,0xb5,0x77,0x95,0xf8,0x64,0xf9,0x64,0x39,0x75,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x9a,0x8d,0xdb,0xd6,0xfb,0xde,0xda,0x95,0xd8,0x5c,0x38,0x85,0x38,0x85,0x77,0x95,0x38,0x7d,0x18,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x79,0x7d,0x3a,0xae,0x99,0x8d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf8,0x64,0x38,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_blizzard_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_blizzard_on_panel_map),
+  .data = icon_blizzard_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_blowing_snow_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x79,0x7d,0xba,0x8d,0x19,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf8,0x6c,0xf8,0x6c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x3a,0xae,0x1c,0xe7,0x9b,0xc6,0x39,0x75,0xd8,0x64,0x18,0x75,0x58,0x85,0x58,0x85,0x18,0x75,0xd8,0x64,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x6d,0xba,0x95,0xfb,0xde,0xfa,0xa5,0xd8,0x64,0x77,0x95,0xb7,0xad,0xb7,0xad,0x77,0x95,0xf8,0x64,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x19,0x6d,0x19,0x6d,0x19,0x6d,0x19,0x6d,0x19,0x6d,0x19,0x6d,0x19,0x6d,0x79,0x85,0xfb,0xde,0x1a,0xae,0xd8,0x5c,0x78,0x8d,0xd7,0xad,0xd7,0xad,0x57,0x8d,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0x9b,0xc6,0xfb,0xd6,0xfb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xfb,0xde,0xdb,0xd6,0x59,0x7d,0xf8,0x64,0x38,0x7d,0x58,0x8d,0x58,0x8d,0x38,0x7d,0xf8,0x64,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x1a,0xa6,0x1a,0xa6,0x1a,0xa6,0x1a,0xa6,0x1a,0xa6,0x1a,0xa6,0xfa,0x9d,0x39,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x18,0x75,0x18,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x1a,0xa6,0x1a,0xa6,0x1a,0xa6,0x1a,0xa6,0x1a,0xa6,0x1a,0xa6,0x1a,0xa6,0x1a,0xa6,0x1a,0xa6,0x1a,0xae,0x1a,0xae,0x1a,0xa6,0x1a,0xa6,0x79,0x85,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0x9b,0xc6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xdb,0xd6,0xfb,0xde,0xfb,0xde,0xba,0x95,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x19,0x6d,0x19,0x6d,0x19,0x6d,0x19,0x6d,0x19,0x6d,0x19,0x6d,0x19,0x6d,0x19,0x6d,0x19,0x6d,0x19,0x6d,0x19,0x6d,0x19,0x6d,0x19,0x6d,0x39,0x75,0xbb,0xce,0x9b,0xc6,0xf9,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x9a,0x85,0xbb,0xce,0x7b,0xbe,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xba,0x8d,0x1c,0xe7,0xdb,0xd6,0x79,0x85,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x39,0x75,0x99,0x8d,0x39,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_blowing_snow_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_blowing_snow_on_panel_map),
+  .data = icon_blowing_snow_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_clear_night_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x3a,0x75,0x19,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x65,0xfc,0x95,0x7d,0xb6,0xbe,0xbe,0x5a,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x7a,0x7d,0x9e,0xb6,0xff,0xce,0xff,0xce,0x5d,0xae,0xf9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x7a,0x7d,0xbe,0xbe,0xff,0xce,0xff,0xce,0xff,0xce,0xfc,0x95,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x19,0x65,0x9e,0xb6,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0x9b,0x85,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xfc,0x95,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0x7b,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0x7d,0xb6,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xbb,0x8d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0x3a,0x75,0xbe,0xc6,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0x1c,0x9e,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0x7a,0x7d,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0x9e,0xb6,0x19,0x65,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0x7a,0x7d,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xdc,0x95,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0x3a,0x75,0xbe,0xc6,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xbe,0xbe,0x5a,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0x7d,0xb6,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xdf,0xce,0x9e,0xbe,0x7a,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xdc,0x95,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xdf,0xce,0xdf,0xce,0xdf,0xce,0xdf,0xce,0xbe,0xc6,0xfc,0x95,0x3a,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x19,0x65,0x7d,0xae,0xdf,0xce,0xdf,0xce,0xdf,0xce,0xdf,0xce,0xdf,0xce,0xdf,0xce,0xdf,0xce,0xdf,0xc6,0xdf,0xc6,0x9e,0xb6,0x3d,0xae,0xdc,0x8d,0x7a,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x5a,0x75,0x9e,0xb6,0xdf,0xce,0xdf,0xce,0xdf,0xce,0xdf,0xce,0xdf,0xc6,0xdf,0xc6,0xdf,0xc6,0xdf,0xc6,0xdf,0xc6,0xdf,0xc6,0xbe,0xbe,0x7a,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x5a,0x75,0x7d,0xae,0xdf,0xc6,0xdf,0xc6,0xdf,0xc6,0xdf,0xc6,0xdf,0xc6,0xdf,0xc6,0xdf,0xc6,0xdf,0xc6,0x7e,0xae,0x7a,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0xdc,0x8d,0x7d,0xae,0xbe,0xbe,0xdf,0xc6,0xdf,0xc6,0xbe,0xbe,0x7e,0xae,0xdc,0x8d,0x19,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x3a,0x6d,0x5a,0x7d,0x5a,0x7d,0x3a,0x6d,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_clear_night_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_clear_night_on_panel_map),
+  .data = icon_clear_night_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_cloudy_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x9a,0x85,0x3b,0xae,0xbc,0xc6,0xbc,0xc6,0x5b,0xb6,0xba,0x8d,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x5b,0xb6,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x9b,0xbe,0x39,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0x7b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0xbc,0xce,0x19,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xda,0x95,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3b,0xae,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xf9,0x64,0xbc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xdf,0x5a,0xb6,0x7b,0xb6,0x3b,0xae,0xba,0x8d,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,
+    0x39,0x75,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xe7,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x7b,0xbe,0x19,0x6d,0xd9,0x5c,
+    0x7a,0x7d,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xe7,0x1c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3b,0xae,0xd9,0x5c,
+    0x39,0x75,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x5d,0xef,0xfc,0xd6,0x39,0x6d,
+    0xf9,0x64,0x9b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x1c,0xdf,0x59,0x75,
+    0xd9,0x5c,0xba,0x8d,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x3c,0xe7,0x5d,0xef,0xfc,0xd6,0x19,0x6d,
+    0xd9,0x5c,0xd9,0x5c,0x3a,0xae,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3a,0xae,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0xfa,0x9d,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x7b,0xb6,0x19,0x6d,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x39,0x75,0xda,0x95,0x3a,0xae,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x3a,0xae,0xba,0x8d,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_cloudy_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_cloudy_on_panel_map),
+  .data = icon_cloudy_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_drizzle_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x39,0x75,0x7a,0x7d,0x39,0x75,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x9a,0x85,0x9b,0xbe,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x9b,0xbe,0x9a,0x85,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xdf,0xda,0x95,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x59,0x75,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xdf,0x7a,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x3b,0xae,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0xdb,0xce,0x9b,0xc6,0xbc,0xc6,0x1b,0xa6,0x39,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xbc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x5d,0xef,0x5d,0xef,0xdc,0xce,0x39,0x6d,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xdc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x3b,0xae,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x9b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x3c,0xe7,0x3c,0xe7,0x5d,0xef,0xbc,0xce,0xf9,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0xbc,0xce,0xf9,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x9b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1a,0xa6,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x6d,0x7b,0xbe,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x7b,0xb6,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x79,0x85,0x1a,0xa6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x3a,0xae,0xba,0x8d,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x54,0xdb,0x35,0xdb,0x35,0xd9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x3a,0x45,0xfe,0x06,0xfe,0x06,0x3a,0x45,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x4d,0xbd,0x16,0xbd,0x16,0x19,0x4d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x4d,0x19,0x4d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_drizzle_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_drizzle_on_panel_map),
+  .data = icon_drizzle_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_flurries_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x39,0x75,0x7a,0x7d,0x39,0x75,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x9a,0x85,0x9b,0xbe,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x9b,0xbe,0x9a,0x85,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xdf,0xda,0x95,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x59,0x75,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xdf,0x7a,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x3b,0xae,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0xdb,0xce,0x9b,0xc6,0xbc,0xc6,0x1b,0xa6,0x39,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xbc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x5d,0xef,0x5d,0xef,0xdc,0xce,0x39,0x6d,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xdc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x3b,0xae,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x9b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x3c,0xe7,0x3c,0xe7,0x5d,0xef,0xbc,0xce,0xf9,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0xbc,0xce,0xf9,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x9b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0xfa,0x9d,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x6d,0x7b,0xb6,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x7b,0xb6,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x79,0x85,0x1a,0xa6,0x5a,0xb6,0x5a,0xb6,0x3a,0xae,0x3a,0xae,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x3a,0xae,0xba,0x8d,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x64,0xd8,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0xd9,0x5c,0x38,0x7d,0x38,0x7d,0xd9,0x5c,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x38,0x7d,0x58,0x85,0x57,0x8d,0x57,0x8d,0x58,0x85,0x38,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x64,0x58,0x8d,0xd7,0xad,0xd7,0xad,0x58,0x8d,0xd8,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf8,0x6c,0x77,0x95,0xb7,0xa5,0xb7,0xa5,0x77,0x95,0xf8,0x6c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x18,0x75,0x18,0x75,0x58,0x85,0x58,0x85,0x18,0x75,0x18,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x18,0x75,0x18,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_flurries_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_flurries_on_panel_map),
+  .data = icon_flurries_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_haze_fog_dust_smoke_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x18,0x6d,0x38,0x75,0xf8,0x6c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf8,0x6c,0x18,0x75,0x18,0x6d,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xf8,0x64,0x58,0x85,0xd8,0xad,0xf8,0xbd,0xf8,0xbd,0xf8,0xb5,0x78,0x95,0x38,0x7d,0x38,0x7d,0x78,0x95,0xf8,0xb5,0xf8,0xbd,0xf8,0xbd,0xb8,0xad,0x58,0x85,0xf8,0x64,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x58,0x8d,0xf8,0xbd,0x98,0x9d,0x38,0x7d,0x18,0x75,0x78,0x8d,0xd8,0xad,0xf8,0xbd,0xf8,0xbd,0xd8,0xad,0x58,0x8d,0x18,0x75,0x38,0x7d,0x97,0x9d,0xd7,0xb5,0x58,0x85,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xf8,0x64,0xf8,0x6c,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x64,0x18,0x75,0x18,0x75,0xd8,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0xf8,0x6c,0xf8,0x64,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf8,0x6c,0x78,0x8d,0xb8,0xad,0xd8,0xad,0x98,0x9d,0x38,0x7d,0xd8,0x5c,0xd8,0x5c,0x38,0x7d,0x98,0x9d,0xd8,0xad,0xb8,0xad,0x78,0x8d,0xf8,0x6c,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x58,0x85,0xf8,0xb5,0xf8,0xb5,0x98,0x9d,0x78,0x95,0xb8,0xad,0xf8,0xbd,0xd8,0xad,0xd8,0xad,0xf8,0xbd,0xb7,0xa5,0x77,0x8d,0x77,0x95,0xd7,0xad,0xd7,0xad,0x38,0x7d,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x18,0x75,0x58,0x85,0xf8,0x64,0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0x18,0x75,0x57,0x8d,0x57,0x8d,0x18,0x75,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xf8,0x64,0x38,0x85,0x18,0x75,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x18,0x6d,0x78,0x8d,0x78,0x95,0x38,0x7d,0xf8,0x64,0xd9,0x5c,0xd9,0x5c,0xf8,0x64,0x38,0x7d,0x78,0x95,0x78,0x8d,0x18,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x18,0x75,0xb8,0xa5,0xf8,0xbd,0xd8,0xb5,0xd8,0xad,0xf8,0xbd,0xd8,0xad,0x78,0x95,0x78,0x95,0xd8,0xad,0xd7,0xb5,0xb7,0xad,0xb7,0xad,0xd7,0xb5,0x97,0x9d,0x18,0x75,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x58,0x85,0xb8,0xa5,0x38,0x7d,0xf8,0x64,0xd8,0x5c,0xf8,0x6c,0x77,0x95,0xb7,0xa5,0xb7,0xa5,0x77,0x95,0xf8,0x6c,0xd8,0x5c,0xd8,0x64,0x38,0x7d,0x97,0xa5,0x38,0x7d,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0xd8,0x5c,0xd8,0x5c,0x18,0x6d,0x18,0x75,0xf8,0x64,0xd9,0x5c,0xd8,0x5c,0xd8,0x5c,0xd9,0x5c,0xf8,0x64,0x18,0x75,0x18,0x6d,0xd8,0x5c,0xd8,0x5c,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xf8,0x64,0x58,0x85,0xb8,0xad,0xf8,0xbd,0xf8,0xbd,0xf8,0xb5,0x78,0x95,0x38,0x7d,0x38,0x7d,0x78,0x95,0xf8,0xb5,0xd7,0xb5,0xd7,0xb5,0xb7,0xa5,0x58,0x85,0xf8,0x64,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x58,0x8d,0xf8,0xbd,0x97,0x9d,0x38,0x7d,0x18,0x75,0x58,0x8d,0xb7,0xad,0xd7,0xb5,0xd7,0xb5,0xb7,0xad,0x58,0x8d,0x18,0x75,0x38,0x7d,0x97,0x9d,0xd7,0xb5,0x58,0x85,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xf8,0x64,0xf8,0x6c,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x64,0x18,0x75,0x18,0x75,0xd8,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0xf8,0x6c,0xf8,0x64,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_haze_fog_dust_smoke_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_haze_fog_dust_smoke_on_panel_map),
+  .data = icon_haze_fog_dust_smoke_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_heavy_rain_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x39,0x75,0x7a,0x7d,0x39,0x75,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x9a,0x85,0x9b,0xbe,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x9b,0xbe,0x9a,0x85,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xdf,0xda,0x95,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x59,0x75,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xdf,0x7a,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x3b,0xae,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0xdb,0xce,0x9b,0xc6,0xbc,0xc6,0x1b,0xa6,0x39,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xbc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x5d,0xef,0x5d,0xef,0xdc,0xce,0x39,0x6d,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xdc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x3b,0xae,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x9b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x3c,0xe7,0x3c,0xe7,0x5d,0xef,0xbc,0xce,0xf9,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0xbc,0xce,0xf9,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x9b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0xfa,0x9d,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x6d,0x7b,0xbe,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x7b,0xb6,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x79,0x85,0x1a,0xa6,0x3a,0xae,0x5a,0xb6,0x3a,0xb6,0x3a,0xb6,0x5a,0xb6,0x5a,0xb6,0x3a,0xb6,0x3a,0xae,0xba,0x8d,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x4d,0x7a,0x3d,0xd9,0x54,0xd9,0x5c,0x5a,0x45,0x5a,0x45,0xd9,0x5c,0xd9,0x54,0x9b,0x3d,0x19,0x4d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x54,0x7d,0x1e,0x1e,0x0f,0x7a,0x3d,0x19,0x4d,0xde,0x0e,0xde,0x0e,0x19,0x4d,0x7a,0x3d,0x1e,0x07,0x7d,0x1e,0xd9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x54,0x9d,0x16,0x3f,0x07,0xbb,0x35,0x3a,0x45,0xfe,0x06,0xfe,0x06,0x3a,0x45,0xbb,0x35,0x3f,0x07,0x9d,0x16,0xf9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x3a,0x45,0x9b,0x3d,0xf9,0x54,0xd9,0x5c,0x7a,0x3d,0x7a,0x3d,0xd9,0x5c,0xf9,0x54,0x9b,0x3d,0x3a,0x45,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x7a,0x45,0x1c,0x2e,0xf9,0x54,0xd9,0x5c,0xbb,0x35,0xbb,0x35,0xd9,0x5c,0xf9,0x54,0x1c,0x2e,0x7a,0x45,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x54,0x9d,0x16,0x3f,0x07,0xbb,0x35,0x3a,0x45,0xfe,0x06,0xfe,0x06,0x3a,0x45,0xbb,0x35,0x3f,0x07,0x9d,0x16,0xf9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x54,0x7d,0x1e,0xfe,0x0e,0x7a,0x3d,0x19,0x4d,0xbd,0x16,0xbd,0x16,0x19,0x4d,0x7a,0x3d,0xfe,0x0e,0x7d,0x1e,0xf9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x4c,0x3a,0x45,0xd9,0x54,0xd9,0x5c,0x19,0x4d,0x19,0x4d,0xd9,0x5c,0xd9,0x54,0x3a,0x45,0xf9,0x4c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_heavy_rain_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_heavy_rain_on_panel_map),
+  .data = icon_heavy_rain_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_heavy_snow_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x39,0x75,0x7a,0x7d,0x39,0x75,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x9a,0x85,0x9b,0xbe,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x9b,0xbe,0x9a,0x85,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xdf,0xda,0x95,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x59,0x75,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xdf,0x7a,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x3b,0xae,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0xdb,0xce,0x9b,0xc6,0xbc,0xc6,0x1b,0xa6,0x39,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xbc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x5d,0xef,0x5d,0xef,0xdc,0xce,0x39,0x6d,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xdc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x3b,0xae,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x9b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x3c,0xe7,0x3c,0xe7,0x5d,0xef,0xbc,0xce,0xf9,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0xbc,0xce,0xf9,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x9b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1a,0xa6,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x6d,0x7b,0xbe,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x7b,0xb6,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x79,0x85,0x1a,0xa6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x3a,0xae,0xba,0x8d,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0xd8,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0xd8,0x5c,0xd9,0x5c,0xd8,0x5c,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0xd9,0x5c,0x18,0x6d,0x78,0x95,0xd9,0x5c,0xd8,0x5c,0xd9,0x5c,0xd8,0x64,0x58,0x85,0x38,0x7d,0xd8,0x5c,0x38,0x7d,0x58,0x8d,0xd8,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf8,0x6c,0x57,0x8d,0x38,0x85,0x77,0x95,0x58,0x85,0x58,0x8d,0xd8,0x5c,0xd8,0x64,0x77,0x95,0x58,0x8d,0xd8,0x5c,0x58,0x85,0x77,0x95,0xf8,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0x38,0x7d,0xb7,0xad,0xd7,0xb5,0x77,0x95,0xf8,0x64,0xd9,0x5c,0xd9,0x5c,0xf8,0x64,0xd8,0x64,0xd9,0x5c,0xd8,0x64,0xf8,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf8,0x64,0x77,0x8d,0x97,0xa5,0xb7,0xad,0x97,0x9d,0x38,0x7d,0xd9,0x5c,0xd8,0x5c,0x18,0x75,0xf8,0x6c,0xd8,0x5c,0xf8,0x6c,0x18,0x75,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf8,0x64,0x18,0x75,0x18,0x75,0x77,0x95,0xf8,0x6c,0x18,0x7d,0xd8,0x5c,0xf8,0x64,0x97,0x9d,0x77,0x8d,0xd8,0x5c,0x58,0x8d,0x97,0x9d,0xf8,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf8,0x64,0x38,0x85,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0x18,0x75,0xf8,0x6c,0xd8,0x5c,0xf8,0x6c,0x18,0x75,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_heavy_snow_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_heavy_snow_on_panel_map),
+  .data = icon_heavy_snow_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_isolated_scattered_tstorms_day_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x16,0x6d,0x35,0x7d,0x16,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x39,0x6d,0x9a,0x85,0x9a,0x85,0x39,0x75,0xf8,0x64,0xb1,0x9d,0x6a,0xde,0xa8,0xee,0x69,0xde,0xb1,0x9d,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x3b,0xae,0x1c,0xdf,0x3c,0xe7,0x5d,0xef,0x1c,0xdf,0x99,0xce,0xab,0xf6,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xa7,0xf6,0x92,0x95,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x7b,0xb6,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x38,0xef,0xca,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0x2c,0xc6,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x14,0xf7,0xca,0xfe,0xca,0xfe,0xc9,0xfe,0x4d,0xd6,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x9b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5c,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5c,0xef,0x3a,0xef,0x3a,0xef,0x3a,0xef,0xf9,0xde,0xba,0x8d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xdc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1a,0xef,0x96,0xee,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x9a,0x8d,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xbc,0xc6,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x52,0xf6,0x32,0xee,0x1c,0xe7,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x9b,0xbe,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x1b,0xa6,0x5d,0xef,0x5d,0xef,0xd8,0xee,0xaa,0xfd,0x32,0xee,0x1c,0xe7,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0xdc,0xce,0xf9,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x19,0x6d,0xdc,0xd6,0x3b,0xef,0xee,0xfd,0x68,0xfd,0x11,0xee,0xda,0xe6,0xfa,0xe6,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3a,0xae,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x5a,0x7d,0x13,0xde,0x89,0xfd,0x69,0xfd,0x8a,0xfd,0xab,0xfd,0x31,0xee,0xfb,0xe6,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0xdb,0xce,0x59,0x75,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd6,0x74,0x4b,0xe5,0x69,0xfd,0x69,0xfd,0x68,0xfd,0x4a,0xed,0xb6,0xb5,0x3a,0xae,0x3a,0xb6,0x5a,0xb6,0x3a,0xb6,0x3a,0xb6,0xfa,0x9d,0x19,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf5,0x7c,0x10,0xad,0x2e,0xbd,0x48,0xf5,0x68,0xfd,0x11,0x9d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x54,0x9b,0x3d,0x19,0x4d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf5,0x7c,0x48,0xf5,0x2c,0xcd,0xd7,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x7a,0x3d,0x1e,0x07,0x7d,0x1e,0xd9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf5,0x7c,0x4a,0xe5,0xf4,0x84,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xbb,0x35,0x3f,0x07,0x9d,0x16,0xf9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf5,0x7c,0x10,0xad,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x54,0x9b,0x3d,0x3a,0x45,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd7,0x64,0xd7,0x64,0xd9,0x5c,0xd9,0x54,0xdb,0x35,0xdb,0x35,0xd9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x3a,0x45,0xfe,0x06,0xfe,0x06,0x3a,0x45,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x4d,0xbd,0x16,0xbd,0x16,0x19,0x4d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x4d,0x19,0x4d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_isolated_scattered_tstorms_day_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_isolated_scattered_tstorms_day_on_panel_map),
+  .data = icon_isolated_scattered_tstorms_day_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_isolated_scattered_tstorms_night_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x65,0x9b,0x85,0xf9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x39,0x6d,0x9a,0x85,0x9a,0x85,0x39,0x75,0xd9,0x5c,0xf9,0x64,0x5d,0xae,0x9e,0xb6,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x3b,0xae,0x1c,0xdf,0x3c,0xe7,0x5d,0xef,0x1c,0xdf,0x5b,0xb6,0xfb,0x95,0xdf,0xc6,0xbe,0xc6,0x5a,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x7b,0xb6,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xdf,0xde,0xce,0xdf,0xc6,0x7d,0xb6,0x5a,0x75,0xf9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1d,0xdf,0xde,0xce,0xdf,0xce,0xbe,0xc6,0x1c,0xa6,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x9b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5c,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3d,0xe7,0x3d,0xe7,0x3d,0xe7,0xfc,0xd6,0xba,0x8d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xdc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1a,0xef,0x96,0xee,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x9a,0x85,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xbc,0xc6,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x52,0xf6,0x32,0xee,0x1c,0xe7,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x9b,0xbe,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x1b,0xa6,0x5d,0xef,0x5d,0xef,0xd8,0xee,0xaa,0xfd,0x32,0xee,0x1c,0xe7,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0xdc,0xce,0xf9,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x19,0x6d,0xdc,0xd6,0x3b,0xef,0x0e,0xfe,0x68,0xfd,0x11,0xee,0xda,0xe6,0xfa,0xe6,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3a,0xae,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x5a,0x7d,0x13,0xde,0x89,0xfd,0x69,0xfd,0x8a,0xfd,0xab,0xfd,0x31,0xee,0xfb,0xe6,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0xdb,0xce,0x59,0x75,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd6,0x74,0x4b,0xe5,0x69,0xfd,0x69,0xfd,0x68,0xfd,0x4a,0xed,0xb6,0xb5,0x3a,0xae,0x3a,0xb6,0x5a,0xb6,0x3a,0xb6,0x3a,0xb6,0xfa,0x9d,0x19,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf5,0x7c,0x10,0xad,0x2e,0xbd,0x48,0xf5,0x68,0xfd,0x11,0x9d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x54,0x9b,0x3d,0x19,0x4d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf5,0x7c,0x48,0xf5,0x2c,0xcd,0xd7,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x7a,0x3d,0x1e,0x07,0x7d,0x1e,0xd9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf5,0x7c,0x4a,0xe5,0xf4,0x84,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xbb,0x35,0x3f,0x07,0x9d,0x16,0xf9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf5,0x7c,0x10,0xad,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x54,0x9b,0x3d,0x3a,0x45,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd7,0x64,0xd7,0x64,0xd9,0x5c,0xd9,0x54,0xdb,0x35,0xdb,0x35,0xd9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x3a,0x45,0xfe,0x06,0xfe,0x06,0x3a,0x45,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x4d,0xbd,0x16,0xbd,0x16,0x19,0x4d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x4d,0x19,0x4d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_isolated_scattered_tstorms_night_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_isolated_scattered_tstorms_night_on_panel_map),
+  .data = icon_isolated_scattered_tstorms_night_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_mostly_clear_night_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x3a,0x75,0x19,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x65,0xfc,0x95,0x7d,0xb6,0xbe,0xbe,0x5a,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x5a,0x75,0x9e,0xb6,0xff,0xce,0xff,0xce,0x5d,0xae,0xf9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x7a,0x7d,0xbe,0xbe,0xff,0xce,0xff,0xce,0xff,0xce,0xfc,0x95,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x19,0x65,0x9e,0xb6,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0x9b,0x85,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xfc,0x95,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0x7b,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0x7d,0xb6,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xbb,0x8d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0x3a,0x75,0xbe,0xc6,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0x1c,0x9e,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0x7a,0x7d,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0x9e,0xb6,0x19,0x65,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0x7a,0x7d,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xff,0xce,0xdc,0x95,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0x3a,0x6d,0xbe,0xc6,0x1e,0xd7,0x1f,0xd7,0xdf,0xce,0xdf,0xce,0xff,0xce,0xff,0xce,0xbe,0xbe,0x5a,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0x7a,0x7d,0x3d,0xdf,0x7d,0xef,0x7e,0xef,0x1e,0xdf,0xdf,0xc6,0xdf,0xce,0xff,0xce,0xdf,0xce,0x9e,0xbe,0x7a,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0x5b,0xae,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x3e,0xe7,0x1e,0xd7,0xdf,0xc6,0xdf,0xce,0xdf,0xce,0xbe,0xc6,0xfc,0x95,0x3a,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0x7b,0xb6,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x9d,0xf7,0x7d,0xef,0xde,0xce,0xdf,0xc6,0xdf,0xce,0xdf,0xc6,0xdf,0xc6,0x9e,0xb6,0x3d,0xae,0xdc,0x95,0x7a,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xba,0x8d,0x3c,0xdf,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xf7,0x7d,0xef,0x9d,0xc6,0x9e,0xbe,0xdf,0xc6,0xdf,0xc6,0xdf,0xc6,0xdf,0xc6,0xdf,0xc6,0xbe,0xbe,0x7a,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x9a,0x85,0x3b,0xae,0x7b,0xb6,0xbc,0xc6,0xfd,0xd6,0xbd,0xce,0x5d,0xbe,0x9e,0xbe,0xbf,0xc6,0xdf,0xc6,0xdf,0xc6,0xdf,0xc6,0x7e,0xae,0x5a,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x9b,0x85,0x1d,0xa6,0x7d,0xb6,0xbe,0xc6,0xbe,0xc6,0x9e,0xbe,0x7e,0xae,0xdc,0x8d,0x19,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x3a,0x6d,0x5a,0x7d,0x5a,0x75,0x3a,0x6d,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_mostly_clear_night_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_mostly_clear_night_on_panel_map),
+  .data = icon_mostly_clear_night_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_mostly_cloudy_day_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf8,0x64,0x16,0x75,0x16,0x6d,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x73,0x8d,0x4c,0xd6,0x89,0xee,0x8a,0xe6,0x2c,0xc6,0x54,0x85,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x9a,0x85,0x3b,0xae,0xbc,0xc6,0xbc,0xc6,0x5b,0xb6,0x17,0xae,0xaa,0xee,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0x89,0xe6,0x54,0x85,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x19,0x6d,0x5b,0xb6,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5c,0xef,0x37,0xef,0xcc,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0x2c,0xc6,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0x7b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x39,0xef,0xca,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0x89,0xe6,0x16,0x6d,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xda,0x95,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x14,0xf7,0xa8,0xfe,0xc7,0xfe,0xc7,0xfe,0x89,0xe6,0x16,0x6d,0xd9,0x5c,0xd9,0x5c,
+    0xf9,0x64,0xbc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3b,0xef,0xf5,0xee,0x15,0xf7,0x14,0xf7,0x92,0xde,0x18,0x6d,0xd9,0x5c,0xd9,0x5c,
+    0x39,0x75,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xe7,0x3d,0xe7,0x5d,0xef,0x5d,0xef,0x7b,0xbe,0x19,0x6d,0xd9,0x5c,
+    0x7a,0x7d,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xe7,0x1c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3b,0xae,0xd9,0x5c,
+    0x39,0x75,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x5d,0xef,0xfc,0xd6,0x19,0x6d,
+    0xf9,0x64,0x9b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x1c,0xdf,0x59,0x7d,
+    0xd9,0x5c,0xba,0x8d,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x3c,0xe7,0x5d,0xef,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0xfb,0xd6,0x19,0x6d,
+    0xd9,0x5c,0xd9,0x5c,0x3a,0xae,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3a,0xae,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0xfa,0x9d,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x7b,0xb6,0x19,0x6d,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x39,0x75,0xda,0x95,0x3a,0xae,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x3a,0xae,0xba,0x8d,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_mostly_cloudy_day_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_mostly_cloudy_day_on_panel_map),
+  .data = icon_mostly_cloudy_day_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_mostly_cloudy_night_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x5c,0x9b,0x85,0x7a,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x3c,0xa6,0xff,0xce,0x9b,0x85,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xdc,0x95,0xff,0xce,0xff,0xce,0x9b,0x85,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x9a,0x85,0x5b,0xae,0xbc,0xc6,0xbc,0xc6,0x7b,0xb6,0xda,0x95,0x7d,0xb6,0xdf,0xce,0xff,0xce,0x1c,0x9e,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x19,0x6d,0x7b,0xb6,0x5c,0xe7,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x3d,0xe7,0xde,0xce,0xdf,0xc6,0xbe,0xc6,0x7a,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0x9b,0xbe,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x3d,0xe7,0xde,0xce,0xdf,0xc6,0x9e,0xbe,0xbb,0x8d,0x19,0x6d,0xf9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xfa,0x95,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x1e,0xdf,0xbf,0xc6,0xdf,0xce,0xdf,0xce,0x9e,0xb6,0xdc,0x8d,0xd9,0x5c,0xd9,0x5c,
+    0xf9,0x64,0xdc,0xce,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x5d,0xef,0xfd,0xde,0x1d,0xdf,0x1e,0xdf,0xdd,0xc6,0x5a,0x75,0xd9,0x5c,0xd9,0x5c,
+    0x39,0x75,0x3c,0xdf,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x1c,0xe7,0x3c,0xe7,0x5d,0xef,0x3c,0xe7,0x7b,0xbe,0x19,0x6d,0xd9,0x5c,
+    0x7a,0x7d,0x3c,0xdf,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x1c,0xe7,0x1c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3b,0xae,0xd9,0x5c,
+    0x39,0x75,0x3c,0xdf,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x5d,0xef,0x1c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x5d,0xef,0xfc,0xd6,0x19,0x6d,
+    0xf9,0x64,0x9b,0xbe,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x5d,0xef,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x1c,0xdf,0x5a,0x7d,
+    0xd9,0x5c,0xba,0x8d,0x5c,0xe7,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x5d,0xef,0x3c,0xe7,0x5d,0xef,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0xfc,0xd6,0x19,0x6d,
+    0xd9,0x5c,0xd9,0x5c,0x3b,0xae,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3a,0xae,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x1b,0xa6,0x1c,0xdf,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x7b,0xb6,0x19,0x6d,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x39,0x75,0xfa,0x9d,0x5b,0xb6,0x7b,0xb6,0x7b,0xb6,0x7b,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x3a,0xae,0xba,0x8d,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_mostly_cloudy_night_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_mostly_cloudy_night_on_panel_map),
+  .data = icon_mostly_cloudy_night_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_mostly_sunny_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf7,0x64,0x35,0x7d,0x73,0x8d,0x73,0x8d,0x35,0x7d,0xf7,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x16,0x75,0xf0,0xad,0x6b,0xde,0xa9,0xee,0xc8,0xfe,0xc8,0xfe,0xa9,0xee,0x6b,0xde,0xcf,0xad,0x16,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x74,0x8d,0x8b,0xde,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0x69,0xde,0x73,0x8d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x74,0x8d,0xaa,0xee,0xe9,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0x88,0xee,0x73,0x8d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x16,0x75,0x8b,0xde,0xe9,0xfe,0xe8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0x69,0xde,0x16,0x6d,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xcf,0xad,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xcf,0xad,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf7,0x64,0x6b,0xde,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0x6a,0xde,0xf7,0x64,0xd9,0x5c,
+    0xd9,0x5c,0x35,0x7d,0xa9,0xee,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xa8,0xee,0x35,0x7d,0xd9,0x5c,
+    0xd9,0x5c,0x73,0x8d,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0x73,0x8d,0xd9,0x5c,
+    0xd9,0x5c,0x73,0x8d,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc6,0xfe,0x53,0x8d,0xd9,0x5c,
+    0xd9,0x5c,0x35,0x7d,0xaa,0xee,0x0f,0xff,0xed,0xfe,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xa7,0xee,0x34,0x7d,0xd9,0x5c,
+    0xd9,0x5c,0x79,0x7d,0x39,0xe7,0x7d,0xef,0x7c,0xf7,0x13,0xf7,0xa8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc6,0xfe,0x69,0xde,0xf7,0x64,0xd9,0x5c,
+    0xd9,0x5c,0x5b,0xae,0x7e,0xef,0x7d,0xef,0x7e,0xef,0x7d,0xef,0x36,0xf7,0x10,0xf7,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc6,0xfe,0xc6,0xfe,0xae,0xad,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0x7b,0xb6,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x9e,0xef,0x7d,0xef,0xad,0xf6,0xa7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc6,0xfe,0xc6,0xfe,0x48,0xde,0xf6,0x6c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xba,0x8d,0x3c,0xdf,0x7d,0xef,0x7d,0xef,0x7e,0xef,0x7e,0xef,0x7c,0xef,0x8c,0xf6,0x86,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc6,0xfe,0xc6,0xfe,0x67,0xee,0x53,0x8d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x9a,0x85,0x3b,0xae,0x7b,0xb6,0xb8,0xd6,0xf5,0xee,0xaf,0xf6,0x47,0xf6,0x66,0xfe,0xa6,0xfe,0xc6,0xfe,0xc6,0xfe,0xc6,0xfe,0x48,0xde,0x53,0x8d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf6,0x6c,0x8e,0xad,0x09,0xde,0x67,0xee,0x86,0xfe,0x86,0xfe,0x87,0xee,0x49,0xde,0xae,0xad,0xf6,0x6c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf7,0x64,0x34,0x7d,0x53,0x8d,0x53,0x8d,0x34,0x7d,0xf7,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_mostly_sunny_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_mostly_sunny_on_panel_map),
+  .data = icon_mostly_sunny_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_partly_cloudy_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf7,0x64,0x55,0x85,0x73,0x8d,0x73,0x8d,0x54,0x85,0xf7,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x16,0x75,0xf0,0xad,0x6a,0xde,0xa8,0xf6,0xc8,0xfe,0xc8,0xfe,0xa8,0xf6,0x6a,0xde,0xcf,0xad,0x16,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x74,0x8d,0x8b,0xde,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0x69,0xde,0x73,0x8d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x74,0x8d,0xaa,0xee,0xe9,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0x88,0xee,0x73,0x8d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x16,0x75,0x8b,0xde,0xe8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0x69,0xde,0x16,0x75,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xcf,0xad,0xe9,0xfe,0xed,0xfe,0x0f,0xff,0x0f,0xff,0xeb,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xcf,0xad,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf7,0x64,0x8e,0xde,0x57,0xf7,0x7c,0xf7,0x7d,0xef,0x7d,0xef,0x7b,0xf7,0x33,0xf7,0xc9,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0x69,0xde,0xf7,0x64,0xd9,0x5c,
+    0xd9,0x5c,0x58,0x7d,0x59,0xef,0x7e,0xef,0x7e,0xef,0x7d,0xef,0x7d,0xef,0x7e,0xef,0x7e,0xef,0x35,0xf7,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xa7,0xf6,0x54,0x85,0xd9,0x5c,
+    0xd9,0x5c,0x5b,0xae,0x7e,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7e,0xef,0x7d,0xef,0xf0,0xf6,0xca,0xfe,0xc9,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0x72,0x8d,0xd9,0x5c,
+    0x19,0x6d,0x1c,0xd7,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7e,0xef,0x7c,0xf7,0x7b,0xf7,0x59,0xf7,0x11,0xf7,0xa8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc6,0xfe,0x72,0x8d,0xd9,0x5c,
+    0x59,0x75,0x3c,0xdf,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7e,0xef,0x7e,0xef,0x7e,0xef,0x7d,0xef,0xf0,0xf6,0xa6,0xfe,0xc6,0xfe,0xa6,0xf6,0x34,0x85,0xd9,0x5c,
+    0x39,0x75,0x3c,0xdf,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7e,0xef,0x39,0xef,0x88,0xfe,0xa6,0xfe,0x68,0xde,0xf7,0x64,0xd9,0x5c,
+    0xf9,0x64,0xbb,0xbe,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7e,0xef,0x5a,0xef,0x69,0xf6,0x86,0xfe,0xae,0xad,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0x9a,0x85,0x3c,0xdf,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7e,0xef,0x17,0xef,0x67,0xf6,0x28,0xde,0x16,0x75,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xba,0x8d,0x1c,0xd7,0x7d,0xef,0x7e,0xef,0x7e,0xef,0x7e,0xef,0x7e,0xef,0x7e,0xef,0x7e,0xef,0x7e,0xef,0x7e,0xef,0x5a,0xef,0x8c,0xf6,0x27,0xee,0x53,0x8d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x6d,0xfa,0x9d,0x97,0xd6,0xf5,0xee,0xf5,0xee,0xf5,0xee,0xf5,0xee,0xf5,0xee,0xf5,0xee,0xd2,0xf6,0x6a,0xf6,0x08,0xde,0x53,0x8d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf6,0x6c,0x6e,0xad,0x08,0xde,0x26,0xee,0x66,0xfe,0x66,0xfe,0x46,0xf6,0x08,0xde,0x8e,0xad,0xf6,0x74,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf7,0x64,0x34,0x85,0x52,0x8d,0x52,0x8d,0x34,0x85,0xf7,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_partly_cloudy_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_partly_cloudy_on_panel_map),
+  .data = icon_partly_cloudy_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_partly_cloudy_night_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x3a,0x75,0x19,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x65,0xfc,0x95,0x9d,0xb6,0xde,0xbe,0x5a,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x7a,0x7d,0x9d,0xbe,0x1f,0xcf,0x1f,0xcf,0x7d,0xae,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x7a,0x7d,0xde,0xc6,0x1f,0xd7,0x1f,0xcf,0x1f,0xcf,0xfc,0x95,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x19,0x65,0xbe,0xbe,0x1f,0xd7,0x1f,0xcf,0x1f,0xcf,0x1f,0xcf,0x9b,0x85,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xfc,0x95,0x1f,0xd7,0x1f,0xd7,0x3f,0xdf,0x3f,0xdf,0x1f,0xd7,0x7b,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0x9d,0xbe,0x5e,0xe7,0x7e,0xef,0x7d,0xef,0x7d,0xef,0x7e,0xef,0x7c,0xb6,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0x7a,0x7d,0x5d,0xe7,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7b,0xb6,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0x5b,0xae,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x5c,0xe7,0xda,0x95,0x19,0x65,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0x19,0x6d,0x1c,0xd7,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x3c,0xdf,0x1c,0xd7,0xdc,0xce,0xda,0x95,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0x59,0x75,0x3c,0xdf,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x5c,0xe7,0xda,0x95,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0x39,0x75,0x3c,0xdf,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0xdc,0xce,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xf9,0x64,0xbb,0xbe,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0xfc,0xd6,0x19,0x65,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0x9a,0x85,0x3c,0xdf,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0xdc,0xce,0x9b,0x8d,0x3a,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xba,0x8d,0x1c,0xd7,0x7d,0xef,0x7d,0xef,0x7d,0xf7,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x7d,0xef,0x3d,0xe7,0x5d,0xbe,0xfc,0xa5,0x3a,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x6d,0xfa,0x9d,0xbc,0xc6,0xfd,0xd6,0xfd,0xd6,0xfd,0xde,0xfd,0xde,0xfd,0xde,0xfd,0xd6,0xdd,0xd6,0x5d,0xbe,0xfc,0xa5,0x3a,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x9b,0x8d,0x1d,0xa6,0x7d,0xb6,0x7d,0xb6,0x7e,0xbe,0x5d,0xb6,0x1d,0xa6,0x9b,0x85,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x3a,0x6d,0x5a,0x7d,0x5a,0x75,0x3a,0x6d,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_partly_cloudy_night_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_partly_cloudy_night_on_panel_map),
+  .data = icon_partly_cloudy_night_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_scattered_showers_day_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x16,0x6d,0x35,0x7d,0x16,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x39,0x6d,0x9a,0x85,0x9a,0x8d,0x39,0x75,0xf8,0x64,0xb1,0x9d,0x6a,0xde,0xa8,0xee,0x69,0xde,0xb1,0x9d,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x3b,0xae,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x1c,0xdf,0x99,0xce,0xab,0xf6,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xa7,0xf6,0x92,0x95,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x7b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x38,0xef,0xca,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0x2c,0xc6,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x14,0xf7,0xca,0xfe,0xca,0xfe,0xc9,0xfe,0x4d,0xd6,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x9b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xef,0x1a,0xe7,0x3a,0xef,0x3a,0xef,0xf9,0xde,0xba,0x8d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xdc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xe7,0x3d,0xe7,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x9a,0x8d,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xbc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x9b,0xbe,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x1b,0xa6,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0xdc,0xce,0xf9,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x19,0x6d,0xdc,0xd6,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3a,0xae,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x59,0x7d,0xdc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0xdb,0xce,0x59,0x75,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x6d,0xba,0x95,0x3a,0xae,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x3a,0xb6,0x3a,0xb6,0xfa,0x9d,0x19,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x4d,0x9b,0x3d,0xd9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x54,0x9b,0x3d,0x19,0x4d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x54,0x7d,0x1e,0x1e,0x0f,0x7a,0x3d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x7a,0x3d,0x1e,0x07,0x7d,0x1e,0xd9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x54,0x9d,0x16,0x3f,0x07,0xbb,0x35,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xbb,0x35,0x3f,0x07,0x9d,0x16,0xf9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x3a,0x45,0x9b,0x3d,0xf9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x54,0x9b,0x3d,0x3a,0x45,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x54,0xdb,0x35,0xdb,0x35,0xd9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x3a,0x45,0xfe,0x06,0xfe,0x06,0x3a,0x45,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x4d,0xbd,0x16,0xbd,0x16,0x19,0x4d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x4d,0x19,0x4d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_scattered_showers_day_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_scattered_showers_day_on_panel_map),
+  .data = icon_scattered_showers_day_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_scattered_showers_night_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x65,0x9b,0x85,0xf9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x39,0x6d,0x9a,0x85,0x9a,0x8d,0x39,0x75,0xd9,0x5c,0xf9,0x64,0x5d,0xae,0x9e,0xb6,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x3b,0xae,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x1c,0xdf,0x5b,0xb6,0xfb,0x9d,0xdf,0xc6,0xbe,0xc6,0x5a,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x7b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3d,0xe7,0xde,0xce,0xdf,0xc6,0x7d,0xb6,0x5a,0x75,0xf9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1d,0xdf,0xde,0xce,0xdf,0xce,0xbe,0xc6,0x1c,0xa6,0xf9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x9b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3d,0xe7,0x1c,0xe7,0x3d,0xe7,0x3d,0xe7,0xfc,0xd6,0xba,0x8d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xdc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xe7,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x9a,0x85,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xbc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x9b,0xbe,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x1b,0xa6,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0xdc,0xce,0xf9,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x19,0x6d,0xdc,0xd6,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3a,0xae,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x59,0x7d,0xdc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0xdb,0xce,0x39,0x75,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x6d,0xba,0x95,0x3a,0xae,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x3a,0xb6,0x3a,0xb6,0xfa,0x9d,0x19,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x4d,0x9b,0x3d,0xd9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x54,0x9b,0x3d,0x19,0x4d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x54,0x7d,0x1e,0x1e,0x0f,0x7a,0x3d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x7a,0x3d,0x1e,0x07,0x7d,0x1e,0xd9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x54,0x9d,0x16,0x3f,0x07,0xbb,0x35,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xbb,0x35,0x3f,0x07,0x9d,0x16,0xf9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x3a,0x45,0x9b,0x3d,0xf9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x54,0x9b,0x3d,0x3a,0x45,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x54,0xdb,0x35,0xdb,0x35,0xd9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x3a,0x45,0xfe,0x06,0xfe,0x06,0x3a,0x45,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x4d,0xbd,0x16,0xbd,0x16,0x19,0x4d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x4d,0x19,0x4d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_scattered_showers_night_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_scattered_showers_night_on_panel_map),
+  .data = icon_scattered_showers_night_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_showers_rain_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x39,0x75,0x7a,0x7d,0x39,0x75,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x9a,0x85,0x9b,0xbe,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x9b,0xbe,0x9a,0x85,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xdf,0xda,0x95,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x59,0x75,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xdf,0x7a,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x3b,0xae,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0xdb,0xce,0x9b,0xc6,0xbc,0xc6,0x1b,0xa6,0x39,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xbc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x5d,0xef,0x5d,0xef,0xdc,0xce,0x39,0x6d,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xdc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x3b,0xae,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x9b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x3c,0xe7,0x3c,0xe7,0x5d,0xef,0xbc,0xce,0xf9,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0xbc,0xce,0xf9,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x9b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1a,0xa6,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x6d,0x7b,0xb6,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x7b,0xb6,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x79,0x85,0x1a,0xa6,0x3a,0xae,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x3a,0xb6,0x3a,0xae,0xba,0x8d,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x4d,0x7a,0x3d,0xd9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x54,0x9b,0x3d,0x19,0x4d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x54,0x7d,0x1e,0x1e,0x0f,0x7a,0x3d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x7a,0x3d,0x1e,0x07,0x7d,0x1e,0xd9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x54,0x9d,0x16,0x3f,0x07,0xbb,0x35,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xbb,0x35,0x3f,0x07,0x9d,0x16,0xf9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x3a,0x45,0x9b,0x3d,0xf9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x54,0x9b,0x3d,0x3a,0x45,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x54,0xdb,0x35,0xdb,0x35,0xd9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x3a,0x45,0xfe,0x06,0xfe,0x06,0x3a,0x45,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x4d,0xbd,0x16,0xbd,0x16,0x19,0x4d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x4d,0x19,0x4d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_showers_rain_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_showers_rain_on_panel_map),
+  .data = icon_showers_rain_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_sleet_hail_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x39,0x75,0x7a,0x7d,0x39,0x75,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x9a,0x85,0x9b,0xbe,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x9b,0xbe,0x9a,0x85,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xdf,0xda,0x95,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x59,0x75,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xdf,0x7a,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x3b,0xae,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0xdb,0xce,0x9b,0xc6,0xbc,0xc6,0x1b,0xa6,0x39,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xbc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x5d,0xef,0x5d,0xef,0xdc,0xce,0x39,0x6d,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xdc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x3b,0xae,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x9b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x3c,0xe7,0x3c,0xe7,0x5d,0xef,0xbc,0xce,0xf9,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0xbc,0xce,0xf9,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x9b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1a,0xa6,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x6d,0x7b,0xbe,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x7b,0xb6,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x79,0x7d,0x1a,0xa6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x3a,0xae,0x5a,0xb6,0x5a,0xb6,0x3a,0xae,0x3a,0xae,0xba,0x8d,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0xf8,0x6c,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x7a,0x7d,0xd9,0x5c,0xd9,0x5c,0x19,0x6d,0x39,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x18,0x6d,0xd7,0xad,0x58,0x85,0xd9,0x5c,0xd9,0x5c,0xfa,0x9d,0x3a,0xae,0xd9,0x5c,0x19,0x6d,0x7b,0xb6,0xba,0x8d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf8,0x64,0x77,0x8d,0xf8,0x6c,0xd9,0x5c,0xfa,0x9d,0x3a,0xae,0xf9,0x64,0x19,0x6d,0x7b,0xb6,0xda,0x95,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xfa,0x9d,0x3a,0xae,0xf9,0x64,0xd9,0x5c,0xba,0x8d,0xda,0x95,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0xba,0x8d,0xf9,0x64,0xd8,0x5c,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0x77,0x95,0x77,0x95,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0x57,0x8d,0x57,0x8d,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_sleet_hail_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_sleet_hail_on_panel_map),
+  .data = icon_sleet_hail_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_snow_showers_snow_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x39,0x75,0x7a,0x7d,0x39,0x75,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x9a,0x85,0x9b,0xbe,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x9b,0xbe,0x9a,0x85,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xdf,0xda,0x95,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x59,0x75,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xdf,0x7a,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x3b,0xae,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0xdb,0xce,0x9b,0xc6,0xbc,0xc6,0x1b,0xa6,0x39,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xbc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x5d,0xef,0x5d,0xef,0xdc,0xce,0x39,0x6d,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xdc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x3b,0xae,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x9b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x3c,0xe7,0x3c,0xe7,0x5d,0xef,0xbc,0xce,0xf9,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0xbc,0xce,0xf9,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x9b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1a,0xa6,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x6d,0x7b,0xb6,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x7b,0xb6,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x79,0x85,0x1a,0xa6,0x3a,0xae,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x3a,0xae,0xba,0x8d,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x64,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0xd9,0x5c,0x38,0x85,0x38,0x7d,0xd9,0x5c,0xd8,0x5c,0xd9,0x5c,0xf8,0x6c,0x77,0x8d,0xf8,0x6c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x38,0x7d,0x58,0x85,0x77,0x8d,0x58,0x8d,0x58,0x8d,0x18,0x75,0xd9,0x5c,0x18,0x75,0x97,0x9d,0x18,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x64,0x57,0x8d,0xd7,0xb5,0xd7,0xad,0x38,0x85,0xd8,0x5c,0xd9,0x5c,0xd8,0x5c,0xf8,0x64,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x18,0x75,0x77,0x95,0xb7,0xad,0xb7,0xa5,0x77,0x95,0xf8,0x6c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x18,0x75,0xf8,0x6c,0x58,0x8d,0x38,0x7d,0x18,0x75,0x18,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x18,0x7d,0x18,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_snow_showers_snow_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_snow_showers_snow_on_panel_map),
+  .data = icon_snow_showers_snow_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_strong_tstorms_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x39,0x6d,0x7a,0x7d,0x39,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x7a,0x85,0x7b,0xbe,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x7b,0xbe,0x7a,0x85,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xdf,0xda,0x95,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x59,0x75,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xdf,0x7a,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x3b,0xae,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0xfc,0xd6,0xbc,0xce,0xbc,0xc6,0x1b,0xa6,0x39,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xbc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0xdc,0xce,0x39,0x6d,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xdc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1a,0xef,0x96,0xee,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3b,0xae,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x7b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x52,0xf6,0x32,0xee,0x1c,0xdf,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0xbc,0xce,0xf9,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x5d,0xef,0x5d,0xef,0xd8,0xee,0x8a,0xfd,0x32,0xee,0x1c,0xe7,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0xbc,0xce,0xf9,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x9b,0xbe,0x3b,0xef,0xee,0xfd,0x68,0xfd,0x11,0xee,0xda,0xe6,0xfa,0xe6,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1a,0xa6,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x6d,0xf3,0xcd,0x89,0xfd,0x69,0xfd,0x8a,0xfd,0xab,0xfd,0x31,0xee,0xfb,0xe6,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x7b,0xb6,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd6,0x74,0x4a,0xe5,0x68,0xfd,0x68,0xfd,0x68,0xfd,0x4a,0xed,0xb6,0xb5,0x1a,0xae,0x3a,0xb6,0x5a,0xb6,0x3a,0xb6,0x3a,0xae,0xba,0x8d,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf5,0x7c,0x10,0xad,0x2e,0xbd,0x48,0xf5,0x68,0xfd,0x11,0x9d,0xf9,0x54,0xbb,0x3d,0xf9,0x54,0xd9,0x5c,0x3a,0x4d,0x7a,0x3d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf5,0x7c,0x48,0xf5,0x2c,0xcd,0xd8,0x64,0x1c,0x26,0x3f,0x07,0xdb,0x35,0xf9,0x54,0x9d,0x16,0xfe,0x06,0x5a,0x45,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf5,0x7c,0x4a,0xe5,0xf4,0x84,0xd9,0x5c,0x5c,0x1e,0x3f,0x07,0x1c,0x2e,0xf9,0x4c,0xde,0x0e,0x1e,0x07,0x7a,0x3d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf5,0x7c,0x10,0xad,0xd9,0x5c,0xd9,0x5c,0x19,0x4d,0x9b,0x35,0xf9,0x4c,0xd9,0x5c,0x3a,0x45,0x7a,0x3d,0xd9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd7,0x64,0xd7,0x64,0xd9,0x5c,0xd9,0x5c,0x3a,0x4d,0x1c,0x26,0x19,0x4d,0xd9,0x5c,0x7a,0x3d,0xfc,0x2d,0xd9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x54,0x5c,0x1e,0x3f,0x07,0x1c,0x2e,0xf9,0x4c,0xde,0x0e,0x3f,0x07,0x7a,0x3d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x1c,0x26,0xfe,0x06,0xdb,0x35,0xf9,0x54,0x7d,0x1e,0xde,0x0e,0x5a,0x45,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x54,0x3a,0x45,0xd9,0x54,0xd9,0x5c,0x19,0x4d,0x3a,0x45,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_strong_tstorms_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_strong_tstorms_on_panel_map),
+  .data = icon_strong_tstorms_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_sunny_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf7,0x64,0x54,0x85,0x73,0x8d,0x73,0x8d,0x54,0x85,0xf7,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x16,0x75,0xd0,0xad,0x6a,0xde,0xa8,0xf6,0xc8,0xfe,0xc8,0xfe,0xa8,0xf6,0x6a,0xde,0xcf,0xad,0x16,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x74,0x8d,0x8b,0xde,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0x69,0xde,0x73,0x8d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x74,0x8d,0xaa,0xee,0xe9,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0x88,0xee,0x73,0x8d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x16,0x75,0x8b,0xde,0xe9,0xfe,0xe8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0x69,0xde,0x16,0x75,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xcf,0xad,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xcf,0xad,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf7,0x64,0x6a,0xde,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0x69,0xde,0xf7,0x64,0xd9,0x5c,
+    0xd9,0x5c,0x54,0x85,0xa8,0xf6,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xa7,0xf6,0x54,0x85,0xd9,0x5c,
+    0xd9,0x5c,0x73,0x8d,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0x72,0x8d,0xd9,0x5c,
+    0xd9,0x5c,0x73,0x8d,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc6,0xfe,0x72,0x8d,0xd9,0x5c,
+    0xd9,0x5c,0x54,0x85,0xa8,0xf6,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc8,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xa6,0xf6,0x34,0x85,0xd9,0x5c,
+    0xd9,0x5c,0xf7,0x64,0x69,0xde,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc6,0xfe,0x68,0xde,0xf7,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xcf,0xad,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc6,0xfe,0xc6,0xfe,0xae,0xad,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x16,0x75,0x69,0xde,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc6,0xfe,0xc6,0xfe,0x48,0xde,0x16,0x75,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x53,0x8d,0x88,0xee,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc6,0xfe,0xc6,0xfe,0x67,0xee,0x53,0x8d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x53,0x8d,0x69,0xde,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc7,0xfe,0xc6,0xfe,0xc6,0xfe,0x48,0xde,0x53,0x8d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x16,0x75,0xaf,0xad,0x69,0xde,0xa7,0xf6,0xc7,0xfe,0xc6,0xfe,0x86,0xf6,0x48,0xde,0xae,0xad,0x16,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf7,0x64,0x34,0x85,0x72,0x8d,0x72,0x8d,0x34,0x85,0xf7,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_sunny_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_sunny_on_panel_map),
+  .data = icon_sunny_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_tornado_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd8,0x5c,0x58,0x85,0x78,0x8d,0x78,0x8d,0x78,0x8d,0x78,0x8d,0x78,0x8d,0x78,0x8d,0x78,0x8d,0x78,0x8d,0x78,0x8d,0x78,0x8d,0x78,0x8d,0x78,0x8d,0x78,0x8d,0x58,0x8d,0xf8,0x64,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd8,0x5c,0xd8,0xad,0xf8,0xbd,0xf8,0xbd,0xf8,0xbd,0xf8,0xbd,0xf8,0xbd,0xf8,0xbd,0xf8,0xbd,0xd7,0xb5,0xd7,0xb5,0xd7,0xb5,0xd7,0xb5,0xd7,0xb5,0xd7,0xb5,0x58,0x8d,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd8,0x5c,0xf8,0x6c,0xf8,0x6c,0xf8,0x6c,0xf8,0x6c,0xf8,0x6c,0xf8,0x6c,0xf8,0x6c,0xf8,0x6c,0xf8,0x6c,0xf8,0x6c,0xf8,0x6c,0xf8,0x6c,0xf8,0x6c,0xf8,0x6c,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0x18,0x6d,0x18,0x6d,0x18,0x6d,0x18,0x6d,0x18,0x6d,0x18,0x6d,0x18,0x6d,0x18,0x6d,0x18,0x6d,0x18,0x6d,0x18,0x6d,0x18,0x6d,0xf8,0x6c,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0xb8,0xa5,0xf8,0xbd,0xf8,0xbd,0xf8,0xbd,0xf8,0xbd,0xf8,0xbd,0xf8,0xbd,0xf8,0xbd,0xf8,0xbd,0xd7,0xb5,0xd7,0xb5,0xd7,0xb5,0xd7,0xad,0x18,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x18,0x75,0x58,0x8d,0x58,0x8d,0x58,0x8d,0x58,0x8d,0x58,0x8d,0x58,0x8d,0x58,0x8d,0x58,0x8d,0x58,0x8d,0x58,0x8d,0x58,0x8d,0x58,0x8d,0x18,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf8,0x6c,0x98,0x9d,0xb8,0xad,0xb8,0xad,0xb8,0xad,0xb8,0xad,0xb8,0xad,0xb8,0xad,0xb7,0xa5,0xb7,0xa5,0xb7,0xa5,0x38,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x38,0x7d,0xb7,0xa5,0xb7,0xa5,0xb7,0xa5,0xb7,0xa5,0xb7,0xa5,0xb7,0xa5,0xb7,0xa5,0xb7,0xa5,0x97,0x9d,0xf8,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0xd8,0x5c,0xd8,0x5c,0xd8,0x5c,0xd8,0x5c,0xd8,0x5c,0xd8,0x5c,0xd8,0x5c,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x64,0x58,0x8d,0x78,0x8d,0x78,0x8d,0x78,0x8d,0x78,0x8d,0x78,0x8d,0x38,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf8,0x64,0xb7,0xad,0xd7,0xb5,0xd7,0xb5,0xd7,0xb5,0xd7,0xb5,0xb7,0xa5,0xf8,0x6c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0xf8,0x6c,0xf8,0x6c,0xf8,0x6c,0xf8,0x6c,0xf8,0x6c,0xf8,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0xf8,0x6c,0x18,0x6d,0x18,0x6d,0xf8,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0x77,0x95,0xd7,0xb5,0xd7,0xb5,0x38,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf8,0x6c,0x58,0x8d,0x58,0x8d,0xf8,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_tornado_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_tornado_on_panel_map),
+  .data = icon_tornado_on_panel_map,
+  .reserved = NULL,
+};
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t icon_wintry_mix_rain_snow_on_panel_map[] = {
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x39,0x75,0x7a,0x7d,0x39,0x75,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x9a,0x85,0x9b,0xbe,0x1c,0xdf,0x1c,0xdf,0x1c,0xdf,0x9b,0xbe,0x9a,0x85,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xdf,0xda,0x95,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x59,0x75,0x1c,0xdf,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1c,0xdf,0x7a,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x3b,0xae,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0xdb,0xce,0x9b,0xc6,0xbc,0xc6,0x1b,0xa6,0x39,0x6d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xbc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x5d,0xef,0x5d,0xef,0xdc,0xce,0x39,0x6d,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xf9,0x64,0xdc,0xce,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x3b,0xae,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0x9b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x1c,0xe7,0x3c,0xe7,0x3c,0xe7,0x5d,0xef,0xbc,0xce,0xf9,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xda,0x95,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0x3c,0xe7,0xbc,0xce,0xf9,0x64,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x9b,0xbe,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x1a,0xa6,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x19,0x6d,0x7b,0xbe,0x3c,0xe7,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x5d,0xef,0x7b,0xb6,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf9,0x64,0x79,0x85,0x1a,0xa6,0x3a,0xae,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x5a,0xb6,0x3a,0xb6,0x3a,0xae,0xba,0x8d,0xf9,0x64,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x64,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x54,0x9b,0x3d,0x19,0x4d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x5c,0xd9,0x5c,0x38,0x85,0x38,0x7d,0xd9,0x5c,0xd8,0x5c,0xd9,0x5c,0x7a,0x3d,0x1e,0x07,0x7d,0x1e,0xd9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x38,0x7d,0x58,0x85,0x77,0x8d,0x58,0x8d,0x58,0x8d,0x18,0x75,0xd9,0x5c,0xbb,0x35,0x3f,0x07,0x9d,0x16,0xf9,0x54,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd8,0x64,0x57,0x8d,0xd7,0xb5,0xd7,0xad,0x38,0x85,0xd8,0x5c,0xd9,0x5c,0xf9,0x54,0x7a,0x3d,0x3a,0x45,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x18,0x75,0x77,0x95,0xb7,0xad,0xb7,0xa5,0x77,0x95,0xf8,0x6c,0xd9,0x5c,0xd8,0x5c,0x18,0x75,0xf8,0x6c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x18,0x75,0xf8,0x6c,0x58,0x8d,0x38,0x7d,0x18,0x75,0x18,0x75,0xd9,0x5c,0x18,0x75,0xd7,0xb5,0x97,0x9d,0xd8,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0x38,0x7d,0x18,0x75,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xf8,0x64,0x77,0x95,0x38,0x7d,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+    0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,0xd9,0x5c,
+};
+
+const lv_image_dsc_t icon_wintry_mix_rain_snow_on_panel = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0,
+  .header.w = 20,
+  .header.h = 20,
+  .header.stride = 40,
+  .header.reserved_2 = 0,
+  .data_size = sizeof(icon_wintry_mix_rain_snow_on_panel_map),
+  .data = icon_wintry_mix_rain_snow_on_panel_map,
+  .reserved = NULL,
+};
@@ -1,12 +1,35 @@
 #!/usr/bin/env python3
 """
-Script to extract non-ASCII characters from weather.ino for LVGL font generation.
+Script to extract non-ASCII characters from the sources for LVGL font generation.
 This helps identify which extended characters are needed for multilingual support.
+
+With --sizes it prints the glyphs each font size needs, as worked out from
+include/translations.h and src/main.cpp. scripts/build_fonts.py uses the
+same glyph_sets() to subset the fonts at build time.
 """
 
 import sys
 import re
 from collections import Counter
+from pathlib import Path
+
+# Files whose string literals end up on screen
+UI_SOURCES = ["include/translations.h", "src/main.cpp"]
+
+# The large font only draws the current temperature
+TEMPERATURE_CHARS = "0123456789-°CF"
+
+# What each get_font_N() caller in src/main.cpp draws:
+#   "text"         location names and transit stops from the network as well
+#                  as UI strings, so every glyph the source font has is kept
+#   "ui"           translated UI strings only (forecast tables, dialog titles)
+#   "temperature"  TEMPERATURE_CHARS plus each language's temp_placeholder
+FONT_CONTENT = {
+    12: "text",
+    14: "text",
+    16: "ui",
+    42: "temperature",
+}
 
 def extract_non_ascii_chars(file_path):
     """Extract and analyze non-ASCII characters from the source file."""
@@ -148,9 +171,72 @@ def extract_string_literals(content):
     else:
         print("No non-ASCII characters found in string literals.")
 
+def string_literal_chars(content):
+    """Every character used inside a C string literal in content."""
+    chars = set()
+    for match in re.finditer(r'"((?:[^"\\\n]|\\.)*)"', content):
+        chars.update(match.group(1))
+    return chars
+
+def temp_placeholders(content):
+    """The first field (temp_placeholder) of each LocalizedStrings table."""
+    pattern = r'LocalizedStrings\s+\w+\s*=\s*\{\s*"((?:[^"\\]|\\.)*)"'
+    return re.findall(pattern, content)
+
+def language_chars(project_root):
+    """Map each language's table in translations.h (strings_en, ...) to the
+    characters its strings use."""
+    translations = (Path(project_root) / "include" / "translations.h").read_text(encoding="utf-8")
+    tables = re.finditer(r'LocalizedStrings\s+strings_(\w+)\s*=\s*\{(.*?)\n\};', translations, re.S)
+    return {m.group(1): string_literal_chars(m.group(2)) for m in tables}
+
+def ui_chars(project_root):
+    """Every character the UI strings use, whatever size they are drawn at."""
+    project_root = Path(project_root)
+    chars = set()
+    for name in UI_SOURCES:
+        chars |= string_literal_chars((project_root / name).read_text(encoding="utf-8"))
+    return chars
+
+def glyph_sets(project_root):
+    """Map each font size to the set of characters it must draw, or None when
+    the size draws arbitrary text and the whole source font is kept."""
+    project_root = Path(project_root)
+    translations = (project_root / "include" / "translations.h").read_text(encoding="utf-8")
+    temperature = set(TEMPERATURE_CHARS).union(*temp_placeholders(translations))
+    ui = ui_chars(project_root)
+
+    sets = {}
+    for size, content in FONT_CONTENT.items():
+        if content == "text":
+            sets[size] = None
+        elif content == "ui":
+            sets[size] = set(ui)
+        else:
+            sets[size] = set(temperature)
+    return sets
+
+def print_glyph_sets(project_root):
+    """Print the extended characters each font size needs."""
+    print("Extended glyphs needed per font size:")
+    for size, chars in sorted(glyph_sets(project_root).items()):
+        if chars is None:
+            print(f"  {size:>2} px: all (draws network text)")
+        else:
+            extended = ''.join(sorted((c for c in chars if ord(c) > 127), key=ord))
+            print(f"  {size:>2} px: {extended or '(none)'}")
+    print("Extended glyphs needed per language:")
+    for language, chars in language_chars(project_root).items():
+        extended = ''.join(sorted((c for c in chars if ord(c) > 127), key=ord))
+        print(f"  {language}: {extended or '(none)'}")
+
 def main():
+    if len(sys.argv) == 2 and sys.argv[1] == "--sizes":
+        print_glyph_sets(Path(__file__).resolve().parent.parent)
+        return
+
     if len(sys.argv) != 2:
-        print("Usage: python3 extract_unicode_chars.py <path_to_weather.ino>")
+        print("Usage: python3 extract_unicode_chars.py <source_file> | --sizes")
         sys.exit(1)
     
     file_path = sys.argv[1]
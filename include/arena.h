@@ -0,0 +1,54 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Bump allocator over a fixed buffer, for scratch memory that lives no
+// longer than one fetch/parse cycle. Allocating is a pointer bump, and
+// releasing everything since a mark is a single assignment, so the general
+// heap never sees the pipeline's short-lived buffers and cannot fragment
+// around them. Loop task only.
+class Arena {
+public:
+  static const size_t ALIGN = 8;
+
+  Arena(void *buf, size_t size);
+
+  // nullptr when the arena is full; the failure is counted
+  void *alloc(size_t size);
+  // Grows in place when ptr is the latest allocation, otherwise copies
+  void *realloc(void *ptr, size_t size);
+  // Only the latest allocation is actually given back; reset() frees the rest
+  void free(void *ptr);
+
+  size_t mark() const { return used_; }
+  void reset(size_t mark = 0) { if (mark < used_) used_ = mark; }
+
+  size_t capacity() const { return size_; }
+  size_t used() const { return used_; }
+  size_t high_water() const { return high_water_; }
+  uint32_t failures() const { return failures_; }
+
+private:
+  uint8_t *buf_;
+  size_t size_;
+  size_t used_;
+  size_t high_water_;
+  uint32_t failures_;
+};
+
+// Releases everything allocated from arena in the enclosing block
+class ArenaScope {
+public:
+  explicit ArenaScope(Arena &arena) : arena_(arena), mark_(arena.mark()) {}
+  ~ArenaScope() { arena_.reset(mark_); }
+  ArenaScope(const ArenaScope &) = delete;
+  ArenaScope &operator=(const ArenaScope &) = delete;
+
+private:
+  Arena &arena_;
+  size_t mark_;
+};
+
+#endif // ARENA_H
@@ -0,0 +1,92 @@
+#ifndef ASSET_IDS_H
+#define ASSET_IDS_H
+
+// Index of the images in the asset partition - generated by
+// scripts/build_assets.py, do not edit
+
+#define ASSET_TABLE_HASH 0x78e8a182U
+#define ASSET_PANEL_BLEND_COLOR 0x5e9bc8
+
+enum AssetId {
+  ASSET_icon_blizzard,
+  ASSET_icon_blizzard_on_panel,
+  ASSET_icon_blowing_snow,
+  ASSET_icon_blowing_snow_on_panel,
+  ASSET_icon_clear_night,
+  ASSET_icon_clear_night_on_panel,
+  ASSET_icon_cloudy,
+  ASSET_icon_cloudy_on_panel,
+  ASSET_icon_drizzle,
+  ASSET_icon_drizzle_on_panel,
+  ASSET_icon_flurries,
+  ASSET_icon_flurries_on_panel,
+  ASSET_icon_haze_fog_dust_smoke,
+  ASSET_icon_haze_fog_dust_smoke_on_panel,
+  ASSET_icon_heavy_rain,
+  ASSET_icon_heavy_rain_on_panel,
+  ASSET_icon_heavy_snow,
+  ASSET_icon_heavy_snow_on_panel,
+  ASSET_icon_isolated_scattered_tstorms_day,
+  ASSET_icon_isolated_scattered_tstorms_day_on_panel,
+  ASSET_icon_isolated_scattered_tstorms_night,
+  ASSET_icon_isolated_scattered_tstorms_night_on_panel,
+  ASSET_icon_mostly_clear_night,
+  ASSET_icon_mostly_clear_night_on_panel,
+  ASSET_icon_mostly_cloudy_day,
+  ASSET_icon_mostly_cloudy_day_on_panel,
+  ASSET_icon_mostly_cloudy_night,
+  ASSET_icon_mostly_cloudy_night_on_panel,
+  ASSET_icon_mostly_sunny,
+  ASSET_icon_mostly_sunny_on_panel,
+  ASSET_icon_partly_cloudy,
+  ASSET_icon_partly_cloudy_night,
+  ASSET_icon_partly_cloudy_night_on_panel,
+  ASSET_icon_partly_cloudy_on_panel,
+  ASSET_icon_scattered_showers_day,
+  ASSET_icon_scattered_showers_day_on_panel,
+  ASSET_icon_scattered_showers_night,
+  ASSET_icon_scattered_showers_night_on_panel,
+  ASSET_icon_showers_rain,
+  ASSET_icon_showers_rain_on_panel,
+  ASSET_icon_sleet_hail,
+  ASSET_icon_sleet_hail_on_panel,
+  ASSET_icon_snow_showers_snow,
+  ASSET_icon_snow_showers_snow_on_panel,
+  ASSET_icon_strong_tstorms,
+  ASSET_icon_strong_tstorms_on_panel,
+  ASSET_icon_sunny,
+  ASSET_icon_sunny_on_panel,
+  ASSET_icon_tornado,
+  ASSET_icon_tornado_on_panel,
+  ASSET_icon_wintry_mix_rain_snow,
+  ASSET_icon_wintry_mix_rain_snow_on_panel,
+  ASSET_image_blizzard,
+  ASSET_image_blowing_snow,
+  ASSET_image_clear_night,
+  ASSET_image_cloudy,
+  ASSET_image_drizzle,
+  ASSET_image_flurries,
+  ASSET_image_haze_fog_dust_smoke,
+  ASSET_image_heavy_rain,
+  ASSET_image_heavy_snow,
+  ASSET_image_isolated_scattered_tstorms_day,
+  ASSET_image_isolated_scattered_tstorms_night,
+  ASSET_image_mostly_clear_night,
+  ASSET_image_mostly_cloudy_day,
+  ASSET_image_mostly_cloudy_night,
+  ASSET_image_mostly_sunny,
+  ASSET_image_partly_cloudy,
+  ASSET_image_partly_cloudy_night,
+  ASSET_image_scattered_showers_day,
+  ASSET_image_scattered_showers_night,
+  ASSET_image_showers_rain,
+  ASSET_image_sleet_hail,
+  ASSET_image_snow_showers_snow,
+  ASSET_image_strong_tstorms,
+  ASSET_image_sunny,
+  ASSET_image_tornado,
+  ASSET_image_wintry_mix_rain_snow,
+  ASSET_COUNT
+};
+
+#endif // ASSET_IDS_H
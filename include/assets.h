@@ -0,0 +1,54 @@
+#ifndef ASSETS_H
+#define ASSETS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <lvgl.h>
+#include "asset_ids.h"
+
+// Weather images and icons live in their own "assets" flash partition rather
+// than in the app, so an OTA update only carries code. scripts/build_assets.py
+// packs assets/*.c into an indexed blob ("make upload" flashes it with the
+// app, "make upload-assets" on its own; OTA cannot write it).
+// At boot the partition is memory-mapped and every image descriptor points
+// straight into flash; nothing is copied to RAM.
+
+#define ASSET_PARTITION_LABEL "assets"
+#define ASSET_PARTITION_SUBTYPE 0x40
+
+#define ASSET_MAGIC 0x54455341  // "ASET"
+#define ASSET_VERSION 1
+
+// Blob layout, little-endian: header, ASSET_COUNT entries, image data
+struct AssetHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t count;
+  uint32_t table_hash;  // ASSET_TABLE_HASH of the asset_ids.h it was packed for
+  uint32_t size;        // Whole blob, header included
+  uint32_t crc32;       // Of everything after the header
+};
+
+struct AssetEntry {
+  uint32_t offset;  // From the start of the blob, 4-byte aligned
+  uint32_t size;
+  uint16_t w;
+  uint16_t h;
+  uint16_t stride;
+  uint8_t cf;       // lv_color_format_t
+  uint8_t reserved;
+};
+
+// Check a packed blob and point the image descriptors into it. Returns false
+// if it is corrupt or was packed for a different asset_ids.h.
+bool assets_bind(const uint8_t *blob, size_t size);
+
+// Map the asset partition and bind it
+bool assets_init();
+
+// Image for id, or nullptr while no valid asset partition is bound
+const lv_img_dsc_t *asset_image(AssetId id);
+
+#define ASSET_IMAGE(name) asset_image(ASSET_##name)
+
+#endif // ASSETS_H
@@ -0,0 +1,53 @@
+#ifndef CITY_INDEX_H
+#define CITY_INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Offline city index for location search.
+// The table is generated at build time by scripts/build_city_index.py into
+// src/city_index_data.c, sorted by folded (lowercase, accent-free) name so a
+// prefix search is a binary search followed by a short forward scan.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Longest folded search key, including names truncated to this length
+#define CITY_KEY_MAX 63
+
+// Code point range folded to ASCII (Latin-1 Supplement, Latin Extended-A)
+#define CITY_FOLD_FIRST 0xC0
+#define CITY_FOLD_LAST 0x17F
+
+#define CITY_NO_ADMIN1 0xFFFF
+
+typedef struct {
+  uint32_t name_ofs;      // UTF-8 display name, offset into city_string_pool
+  uint16_t admin1;        // Index into city_admin1_ofs, or CITY_NO_ADMIN1
+  uint16_t population_k;  // Population in thousands, saturated at 65535
+  int32_t lat_e5;         // Latitude in 1e-5 degrees
+  int32_t lon_e5;         // Longitude in 1e-5 degrees
+} CityRecord;
+
+extern const CityRecord city_records[];
+extern const uint32_t city_record_count;
+extern const char city_string_pool[];
+extern const uint32_t city_admin1_ofs[];
+extern const char city_fold_latin[CITY_FOLD_LAST - CITY_FOLD_FIRST + 1];
+
+// Fold UTF-8 text into a lowercase ASCII search key; returns the key length
+size_t city_fold(const char *text, char *key, size_t key_size);
+
+// Find cities whose name starts with prefix, most populous first.
+// Returns the number of records written to out (at most max_out).
+size_t city_index_search(const char *prefix, const CityRecord **out, size_t max_out);
+
+const char *city_name(const CityRecord *city);
+const char *city_admin1(const CityRecord *city);  // nullptr if unknown
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CITY_INDEX_H
@@ -0,0 +1,36 @@
+#ifndef FORECAST_TABLE_H
+#define FORECAST_TABLE_H
+
+#include <lvgl.h>
+
+// Seven-row forecast table drawn straight from its row data in the panel's
+// draw event, instead of three labels and an image per row. Each row is
+//   label   icon   ...   secondary   primary
+// Primary text and the label use the panel's LV_PART_MAIN text style and the
+// secondary column uses LV_PART_ITEMS. Changing a row only invalidates
+// that row's rectangle.
+
+#define FORECAST_TABLE_ROWS 7
+#define FORECAST_TABLE_ROW_HEIGHT 24
+
+struct ForecastRow {
+  char label[16];      // Day or hour
+  char secondary[16];  // Low temperature or precipitation
+  char primary[16];    // High or hourly temperature
+  const lv_img_dsc_t *icon;
+};
+
+struct ForecastTable {
+  ForecastRow rows[FORECAST_TABLE_ROWS];
+  int32_t secondary_right;  // Right edge of the secondary column, left of the content's right edge
+};
+
+// Draw table's rows on top of obj's background. table must outlive obj;
+// its rows are cleared here.
+void forecast_table_attach(lv_obj_t *obj, ForecastTable *table, int32_t secondary_right);
+
+// Update one row, redrawing it only if something changed
+void forecast_table_set_row(lv_obj_t *obj, int row, const char *label, const lv_img_dsc_t *icon,
+                            const char *secondary, const char *primary);
+
+#endif // FORECAST_TABLE_H
@@ -0,0 +1,52 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Leveled logger that never blocks or allocates in the caller. Lines are
+// formatted straight into a fixed ring of slots and written to Serial by a
+// low-priority task, so a 250 character URL costs a vsnprintf instead of
+// ~20 ms of UART time and a temporary String. When the ring is full the
+// line is dropped and counted. Levels above CONFIG_LOG_LEVEL compile out.
+
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+
+#ifndef CONFIG_LOG_LEVEL
+#define CONFIG_LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+#define LOG_SLOT_COUNT 16
+#define LOG_LINE_MAX 256  // Longer lines are truncated
+
+// Start the task that drains the ring to Serial; lines logged earlier wait
+void log_init();
+
+// Format one line (no trailing newline needed) into the ring
+void log_write(int level, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+
+// Take the oldest line out of the ring; returns its length, 0 if empty
+size_t log_pop(char *out, size_t size, int *level);
+
+// Wait up to timeout_ms for everything logged so far to reach the UART,
+// e.g. before a restart. Blocks, so keep it out of normal paths.
+void log_flush(uint32_t timeout_ms);
+
+// Lines lost because the ring was full
+uint32_t log_dropped();
+
+#define LOG_AT(level, ...) \
+  do { \
+    if (CONFIG_LOG_LEVEL >= (level)) log_write((level), __VA_ARGS__); \
+  } while (0)
+
+#define LOG_E(...) LOG_AT(LOG_LEVEL_ERROR, __VA_ARGS__)
+#define LOG_W(...) LOG_AT(LOG_LEVEL_WARN, __VA_ARGS__)
+#define LOG_I(...) LOG_AT(LOG_LEVEL_INFO, __VA_ARGS__)
+#define LOG_D(...) LOG_AT(LOG_LEVEL_DEBUG, __VA_ARGS__)
+
+#endif // LOG_H
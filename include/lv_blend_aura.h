@@ -0,0 +1,56 @@
+#ifndef LV_BLEND_AURA_H
+#define LV_BLEND_AURA_H
+
+#include <stdint.h>
+
+// RGB565 fill and blend kernels for LVGL's software renderer, plugged in
+// with LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM. LVGL includes this
+// header from its RGB565 blend code and calls the macros below before its
+// generic C loops. The kernels read and write two pixels per 32-bit access
+// and mix with exactly the same arithmetic as lv_color_16_16_mix(), so the
+// output is bit-identical. They only take plain buffers, so they also
+// build on the host. Strides are in bytes.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void aura_fill_rgb565(uint16_t *dest, int32_t w, int32_t h, int32_t dest_stride, uint16_t color);
+void aura_fill_rgb565_opa(uint16_t *dest, int32_t w, int32_t h, int32_t dest_stride,
+                          uint16_t color, uint8_t opa);
+void aura_fill_rgb565_mask(uint16_t *dest, int32_t w, int32_t h, int32_t dest_stride,
+                           uint16_t color, const uint8_t *mask, int32_t mask_stride);
+void aura_blit_rgb565(uint16_t *dest, int32_t w, int32_t h, int32_t dest_stride,
+                      const uint16_t *src, int32_t src_stride);
+void aura_blit_rgb565_mask(uint16_t *dest, int32_t w, int32_t h, int32_t dest_stride,
+                           const uint16_t *src, int32_t src_stride,
+                           const uint8_t *mask, int32_t mask_stride);
+
+#ifdef __cplusplus
+}
+#endif
+
+// Hooks expanded inside LVGL's lv_draw_sw_blend_to_rgb565.c
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565(dsc) \
+  (aura_fill_rgb565((uint16_t *)(dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, (dsc)->dest_stride, \
+                    lv_color_to_u16((dsc)->color)), LV_RESULT_OK)
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA(dsc) \
+  (aura_fill_rgb565_opa((uint16_t *)(dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, (dsc)->dest_stride, \
+                        lv_color_to_u16((dsc)->color), (dsc)->opa), LV_RESULT_OK)
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK(dsc) \
+  (aura_fill_rgb565_mask((uint16_t *)(dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, (dsc)->dest_stride, \
+                         lv_color_to_u16((dsc)->color), (dsc)->mask_buf, (dsc)->mask_stride), LV_RESULT_OK)
+
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565(dsc) \
+  (aura_blit_rgb565((uint16_t *)(dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, (dsc)->dest_stride, \
+                    (const uint16_t *)(dsc)->src_buf, (dsc)->src_stride), LV_RESULT_OK)
+
+// RGB565A8 images arrive here with their alpha plane as the mask
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc) \
+  (aura_blit_rgb565_mask((uint16_t *)(dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, (dsc)->dest_stride, \
+                         (const uint16_t *)(dsc)->src_buf, (dsc)->src_stride, \
+                         (dsc)->mask_buf, (dsc)->mask_stride), LV_RESULT_OK)
+
+#endif // LV_BLEND_AURA_H
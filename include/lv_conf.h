@@ -108,11 +108,16 @@
  * - LV_OS_RTTHREAD
  * - LV_OS_WINDOWS
  * - LV_OS_CUSTOM */
-#define LV_USE_OS   LV_OS_NONE
+#define LV_USE_OS   LV_OS_FREERTOS
 
 #if LV_USE_OS == LV_OS_CUSTOM
     #define LV_OS_CUSTOM_INCLUDE <stdint.h>
 #endif
+#if LV_USE_OS == LV_OS_FREERTOS
+    /*Wake the draw thread with direct task notifications instead of semaphores.
+     *Only valid while each notification has a single receiving task*/
+    #define LV_USE_FREERTOS_TASK_NOTIFY 1
+#endif
 
 /*========================
  * RENDERING CONFIGURATION
@@ -128,9 +133,14 @@
 #if LV_USE_DRAW_SW == 1
     /* Set the number of draw unit.
      * > 1 requires an operating system enabled in `LV_USE_OS`
-     * > 1 means multiply threads will render the screen in parallel */
+     * > 1 means multiply threads will render the screen in parallel
+     * One until a second unit is measured faster on the device; it costs
+     * another thread stack and only helps when a frame has independent tasks */
     #define LV_DRAW_SW_DRAW_UNIT_CNT    1
 
+    /* Stack size of each draw unit's thread */
+    #define LV_DRAW_THREAD_STACK_SIZE   (8 * 1024)
+
     /* Use Arm-2D to accelerate the sw render */
     #define LV_USE_DRAW_ARM2D_SYNC      0
 
@@ -159,10 +169,11 @@
         #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
     #endif
 
-    #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
+    /* RGB565 fill and blend kernels in src/lv_blend_aura.c */
+    #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_CUSTOM
 
     #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
-        #define  LV_DRAW_SW_ASM_CUSTOM_INCLUDE ""
+        #define  LV_DRAW_SW_ASM_CUSTOM_INCLUDE "lv_blend_aura.h"
     #endif
 #endif
 
@@ -403,7 +414,7 @@
 #define LV_FONT_MONTSERRAT_14 1  /* Fallback for lv_font_montserrat_latin_14 + default */
 #define LV_FONT_MONTSERRAT_16 1  /* Fallback for lv_font_montserrat_latin_16 */
 #define LV_FONT_MONTSERRAT_18 0
-#define LV_FONT_MONTSERRAT_20 1  /* Fallback for lv_font_montserrat_latin_20 */
+#define LV_FONT_MONTSERRAT_20 0
 #define LV_FONT_MONTSERRAT_22 0
 #define LV_FONT_MONTSERRAT_24 0
 #define LV_FONT_MONTSERRAT_26 0
@@ -414,7 +425,7 @@
 #define LV_FONT_MONTSERRAT_36 0
 #define LV_FONT_MONTSERRAT_38 0
 #define LV_FONT_MONTSERRAT_40 0
-#define LV_FONT_MONTSERRAT_42 1  /* Fallback for lv_font_montserrat_latin_42 */
+#define LV_FONT_MONTSERRAT_42 0  /* Copied into lv_font_montserrat_latin_42 by scripts/build_fonts.py */
 #define LV_FONT_MONTSERRAT_44 0
 #define LV_FONT_MONTSERRAT_46 0
 #define LV_FONT_MONTSERRAT_48 0
@@ -756,7 +767,7 @@
  *==================*/
 
 /*1: Enable API to take snapshot for object*/
-#define LV_USE_SNAPSHOT 0
+#define LV_USE_SNAPSHOT 1
 
 /*1: Enable system monitor component*/
 #define LV_USE_SYSMON   0
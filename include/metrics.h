@@ -0,0 +1,51 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Counters behind the /metrics endpoint. Updating one is a couple of relaxed
+// atomic stores, cheap enough for lv_timer_handler() and the touch path; the
+// Prometheus text is only built when something scrapes the device.
+
+enum MetricsFetch {
+  METRICS_FETCH_WEATHER,   // Open-Meteo forecast
+  METRICS_FETCH_GEOCODE,   // Open-Meteo location search
+  METRICS_FETCH_TRANSIT,   // TfL arrivals, one per stop
+  METRICS_FETCH_COUNT
+};
+
+// Sampled when the page is built rather than counted
+struct MetricsGauges {
+  uint32_t heap_free;
+  uint32_t heap_min_free;
+  uint32_t heap_largest_block;
+  int32_t wifi_rssi;          // 0 when not connected
+  uint32_t uptime_s;
+  uint32_t log_dropped;
+  uint32_t lvgl_mem_total;    // 0 when LVGL uses the system heap
+  uint32_t lvgl_mem_used;
+  uint32_t arena_capacity;    // Per-refresh scratch arena
+  uint32_t arena_high_water;
+  uint32_t arena_failures;
+  uint32_t main_screen_heap;  // Taken by the last create_ui(), 0 before it
+};
+
+// One HTTP request, from begin() to the body being parsed
+void metrics_fetch(MetricsFetch kind, uint32_t duration_ms, bool ok);
+
+void metrics_wifi_reconnect();
+void metrics_touch();
+void metrics_timer_handler(uint32_t duration_us);
+void metrics_frame(uint32_t duration_us);
+// Time between two lv_timer_handler() runs, i.e. how long the UI went
+// without reading touch or redrawing
+void metrics_ui_gap(uint32_t duration_us);
+// Tap (LV_EVENT_CLICKED) to the end of the next redraw
+void metrics_touch_latency(uint32_t duration_us);
+
+// Write the Prometheus text exposition into buf; returns its length. The
+// _max gauges restart from zero after every scrape.
+size_t metrics_format(char *buf, size_t size, const MetricsGauges &gauges);
+
+#endif // METRICS_H
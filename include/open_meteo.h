@@ -0,0 +1,128 @@
+#ifndef OPEN_METEO_H
+#define OPEN_METEO_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Streaming parser for Open-Meteo forecast responses requested with
+// timeformat=unixtime, for one location (an object) or several (an array).
+// Numbers are read straight into fixed-point integers, so neither parsing
+// nor formatting the forecast needs any floating point.
+
+#define FORECAST_DAYS 7
+#define FORECAST_HOURS 7
+
+// Temperatures are in tenths of a degree and precipitation in hundredths
+// of a mm or inch, in whatever units the request asked for
+struct DailyForecast {
+  uint32_t time;  // Local midnight, unix seconds
+  int16_t t_min;
+  int16_t t_max;
+  uint8_t code;
+};
+
+struct HourlyForecast {
+  uint32_t time;
+  int16_t temp;
+  uint16_t precip;
+  uint8_t precip_prob;
+  uint8_t code;
+  uint8_t is_day;
+};
+
+struct WeatherModel {
+  bool valid;
+  bool fahrenheit;  // Units requested: °F and inch, otherwise °C and mm
+  int32_t utc_offset_seconds;
+  int16_t t_now;
+  int16_t t_feels;
+  uint8_t code_now;
+  uint8_t is_day;
+  uint32_t sunrise;  // Today's, 0 if unknown
+  uint32_t sunset;
+  DailyForecast daily[FORECAST_DAYS];
+  HourlyForecast hourly[FORECAST_HOURS];
+};
+
+class OpenMeteoParser {
+ public:
+  // Locations are written to models in response order, at most count of them
+  OpenMeteoParser(WeatherModel *models, int count);
+
+  void reset();
+  void feed(const char *data, size_t len);
+
+  // True once the top-level value has been closed
+  bool complete() const { return done_; }
+  int parsed() const { return parsed_; }
+
+ private:
+  enum Section : uint8_t { SEC_NONE, SEC_UTC_OFFSET, SEC_CURRENT, SEC_DAILY, SEC_HOURLY };
+  enum Field : uint8_t {
+    F_NONE, F_TIME, F_TEMP, F_APPARENT, F_TEMP_MIN, F_TEMP_MAX, F_CODE, F_IS_DAY,
+    F_SUNRISE, F_SUNSET, F_PRECIP, F_PRECIP_PROB
+  };
+
+  void feed_char(char c);
+  void open_container(bool object);
+  void close_container();
+  void end_key();
+  void end_number();
+  int32_t fixed(int32_t scale) const;
+
+  WeatherModel *models_;
+  int count_;
+
+  // Tokenizer state
+  uint8_t depth_;
+  uint8_t loc_depth_;     // Depth of the location objects: 1, or 2 in an array
+  uint32_t object_mask_;  // Bit n set if the container at depth n is an object
+  bool done_;
+  bool in_string_;
+  bool escape_;
+  bool expect_key_;
+  bool in_number_;
+  bool negative_;
+  uint8_t frac_digits_;
+  uint32_t int_part_;
+  uint16_t frac_part_;  // Thousandths
+
+  // Key being captured, and where the next value belongs
+  char key_[32];
+  uint8_t key_len_;
+  Section section_;
+  Field field_;
+  uint8_t index_;
+
+  WeatherModel *current_;
+  int parsed_;
+};
+
+// Round a fixed-point value to the nearest whole unit, halves away from zero
+int32_t fixed_round(int32_t value, int32_t scale);
+
+// Integer-only formatting for forecast labels. Both return the length
+// written and always terminate buf.
+size_t format_int(char *buf, size_t size, int32_t value);
+size_t format_fixed(char *buf, size_t size, int32_t value, int decimals);  // 123, 2 -> "1.23"
+
+// Hourly precipitation label, "1.2mm" or "0.3in": one decimal once the
+// amount reaches 0.1 of the unit, as before fixed-point parsing. Below that
+// writes "" and returns 0 so the caller can show the probability instead.
+size_t format_precip(char *buf, size_t size, uint16_t hundredths, bool inches);
+
+// Calendar fields of a unix time at a given UTC offset
+static inline uint32_t local_seconds(uint32_t t, int32_t utc_offset) {
+  return t + (uint32_t)utc_offset;
+}
+static inline int local_hour(uint32_t t, int32_t utc_offset) {
+  return (local_seconds(t, utc_offset) % 86400) / 3600;
+}
+static inline int local_minute(uint32_t t, int32_t utc_offset) {
+  return (local_seconds(t, utc_offset) % 3600) / 60;
+}
+static inline int local_weekday(uint32_t t, int32_t utc_offset) {
+  return (local_seconds(t, utc_offset) / 86400 + 4) % 7;  // 1970-01-01 was a Thursday; 0 = Sunday
+}
+
+#endif // OPEN_METEO_H
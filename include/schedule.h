@@ -0,0 +1,35 @@
+#ifndef SCHEDULE_H
+#define SCHEDULE_H
+
+#include <stdint.h>
+
+// How often the device goes to the network and moves between panels.
+// Shared by src/main.cpp and the host traffic simulation
+// (scripts/traffic_test.cpp), so the simulation counts the requests the
+// firmware would make.
+
+#define UPDATE_INTERVAL 600000UL        // Forecast, 10 minutes
+#define TRANSIT_REFRESH_INTERVAL 5000   // TfL arrivals while transit is on
+#define LOCATION_ROTATE_INTERVAL 15000  // 15 seconds per saved location
+
+// Periodic deadline on the wrapping millisecond clock, run the way an
+// lv_timer runs: due once period has passed since the last run, and the
+// next period counts from when it ran rather than from when it was due
+class Interval {
+public:
+  Interval(uint32_t period, uint32_t now) : period_(period), last_(now) {}
+
+  // True, and counted as run, once period has passed
+  bool due(uint32_t now);
+  // Count the period from now, e.g. after a run that was not due
+  void restart(uint32_t now) { last_ = now; }
+
+  void set_period(uint32_t period) { period_ = period; }
+  uint32_t period() const { return period_; }
+
+private:
+  uint32_t period_;
+  uint32_t last_;
+};
+
+#endif // SCHEDULE_H
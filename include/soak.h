@@ -0,0 +1,77 @@
+#ifndef SOAK_H
+#define SOAK_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Soak mode (CONFIG_SOAK_TEST, pio run -e soak) replaces the network with
+// synthetic forecasts and runs refreshes, panel slides, the settings window
+// and location searches back to back on an accelerated LVGL clock, so weeks
+// of uptime pass in hours. SoakMonitor decides whether the heap is holding
+// steady. The generated responses also serve as the stub endpoints of the
+// traffic simulation (CONFIG_TRAFFIC_SIM).
+
+// Open-Meteo forecast response (timeformat=unixtime) for count locations,
+// as an array when there are several. seed varies the values so labels
+// change length from one refresh to the next. Returns the length, or 0 if
+// it did not fit.
+size_t soak_forecast_json(char *buf, size_t size, int count, uint32_t seed, uint32_t now);
+
+// TfL StopPoint arrivals response with count predictions in no particular
+// order, as the API sends them. Returns the length, or 0 if it did not fit.
+size_t soak_arrivals_json(char *buf, size_t size, int count, uint32_t seed);
+
+struct HeapSample {
+  uint32_t in_use;
+  uint32_t free;
+  uint32_t largest_free;
+  uint32_t lvgl_used;      // 0 when LVGL uses the system heap
+  uint8_t lvgl_frag_pct;
+};
+
+// Fed one sample per cycle. The first warmup_windows windows set the
+// baseline: the highest floor (lowest in-use reading in a window) and the
+// worst fragmentation. After that a window whose floor rises more than
+// tolerance bytes above the baseline, or whose fragmentation is more than
+// 10 points worse, is a failure. Floors rather than peaks, so the transient
+// buffers of whatever was running when a sample was taken do not count.
+class SoakMonitor {
+public:
+  SoakMonitor(uint32_t window, uint32_t warmup_windows, uint32_t tolerance);
+
+  // False once the heap has grown; stays false
+  bool sample(const HeapSample &s);
+
+  bool failed() const { return failed_; }
+  uint32_t samples() const { return samples_; }
+  uint32_t peak_in_use() const { return peak_in_use_; }
+  uint32_t baseline() const { return baseline_floor_; }
+
+  // One line summary, or the reason for the failure
+  void report(char *buf, size_t size) const;
+
+private:
+  static uint8_t frag_pct(const HeapSample &s);
+
+  uint32_t window_;
+  uint32_t warmup_windows_;
+  uint32_t tolerance_;
+
+  uint32_t samples_;
+  uint32_t windows_;
+  uint32_t peak_in_use_;
+  HeapSample last_;
+
+  uint32_t window_floor_;
+  uint32_t window_lvgl_floor_;
+  uint8_t window_frag_;
+
+  uint32_t baseline_floor_;
+  uint32_t baseline_lvgl_floor_;
+  uint8_t baseline_frag_;
+
+  bool failed_;
+  char reason_[96];
+};
+
+#endif // SOAK_H
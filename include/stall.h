@@ -0,0 +1,48 @@
+#ifndef STALL_H
+#define STALL_H
+
+#include <stdint.h>
+
+// Loop stall monitor. Each stage of loop(), each LVGL timer callback and
+// each fetch is bracketed with stall_enter()/stall_exit(); a stage whose own
+// time (not counting stages nested inside it) reaches the threshold is
+// logged and competes for a place in the top STALL_TOP_N. The table and the
+// stage running at the time live in RTC memory, so a watchdog or panic
+// reset still shows what the UI was stuck in. Loop task only.
+
+#define STALL_TOP_N 5
+#define STALL_DEPTH 6       // Deepest nesting of stages that is timed
+#define STALL_NAME_MAX 32   // Longer stage names are truncated
+
+struct StallRecord {
+  char stage[STALL_NAME_MAX];
+  uint32_t duration_ms;
+  uint32_t heap_free;       // When the stage finished
+  uint32_t heap_largest;
+  uint32_t uptime_s;
+  uint32_t boot;            // Soft resets since power-on when it happened
+};
+
+// Check the retained table, count the boot and log what it holds
+void stall_init(uint32_t threshold_ms);
+
+// stage must outlive the matching stall_exit(), e.g. a string literal
+void stall_enter(const char *stage);
+void stall_exit();
+
+// Longest first; returns how many there are
+int stall_top(const StallRecord **records);
+
+// Stalls over the threshold since power-on
+uint32_t stall_count();
+
+// Stage that was running when the previous boot reset, or nullptr
+const char *stall_reset_stage();
+
+// Times the rest of the enclosing block as a stage
+struct StallScope {
+  explicit StallScope(const char *stage) { stall_enter(stage); }
+  ~StallScope() { stall_exit(); }
+};
+
+#endif // STALL_H
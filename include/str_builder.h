@@ -0,0 +1,48 @@
+#ifndef STR_BUILDER_H
+#define STR_BUILDER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Builds a string in a fixed buffer instead of growing an Arduino String,
+// so URLs and labels cost no heap and cannot fragment it. The text is
+// always terminated; whatever does not fit is dropped and truncated() says
+// so, which callers building URLs should treat as an error.
+class StrBuilder {
+public:
+  StrBuilder(char *buf, size_t size);
+
+  StrBuilder &add(const char *s);
+  StrBuilder &add(char c);
+  StrBuilder &add_int(int32_t value);
+  StrBuilder &add_int(int32_t value, int min_digits);  // Zero padded
+  StrBuilder &add_urlencoded(const char *s);            // RFC 3986 percent-encoding
+  StrBuilder &addf(const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+
+  void clear();
+  const char *c_str() const { return buf_; }
+  size_t length() const { return len_; }
+  bool truncated() const { return truncated_; }
+
+private:
+  char *buf_;
+  size_t size_;
+  size_t len_;
+  bool truncated_;
+};
+
+// StrBuilder with its own buffer, for locals:
+//   StackStr<128> url;
+//   url.add("https://...").add_urlencoded(q);
+template <size_t N>
+class StackStr : public StrBuilder {
+public:
+  StackStr() : StrBuilder(storage_, N) {}
+  StackStr(const StackStr &) = delete;
+  StackStr &operator=(const StackStr &) = delete;
+
+private:
+  char storage_[N];
+};
+
+#endif // STR_BUILDER_H
@@ -0,0 +1,91 @@
+#ifndef TFL_ARRIVALS_H
+#define TFL_ARRIVALS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Streaming parser for the TfL StopPoint/{id}/Arrivals response.
+// Bytes are fed straight from the socket; only lineName, destinationName,
+// towards and timeToStation of each top-level arrival object are kept, and
+// a fixed-size heap retains the soonest arrivals across any number of stops.
+// Memory use is constant regardless of response size.
+
+#define ARRIVALS_SHOWN 4
+
+struct ArrivalInfo {
+  char line[16];
+  char destination[32];
+  int timeToStation;  // seconds
+};
+
+// Keeps the ARRIVALS_SHOWN arrivals with the smallest timeToStation.
+// Stored as a max-heap so the latest kept arrival is always at the root.
+class ArrivalTopK {
+ public:
+  ArrivalTopK() : count_(0) {}
+
+  void clear() { count_ = 0; }
+  void offer(const ArrivalInfo &arrival);
+
+  // Move the kept arrivals into out, soonest first; returns the count
+  int take_sorted(ArrivalInfo *out);
+
+ private:
+  void sift_down(int i);
+
+  ArrivalInfo heap_[ARRIVALS_SHOWN];
+  int count_;
+};
+
+class ArrivalParser {
+ public:
+  // prefer_towards: use "towards" (tube) over "destinationName" (bus)
+  ArrivalParser(ArrivalTopK &top, bool prefer_towards);
+
+  void reset();
+  void feed(const char *data, size_t len);
+
+  // True once the top-level array has been closed
+  bool complete() const { return done_; }
+  int parsed() const { return parsed_; }
+
+ private:
+  enum Field : uint8_t { FIELD_NONE, FIELD_LINE, FIELD_DESTINATION, FIELD_TOWARDS, FIELD_TIME };
+
+  void feed_char(char c);
+  void string_char(char c);
+  void end_string();
+  void end_number();
+  void begin_arrival();
+  void end_arrival();
+
+  ArrivalTopK &top_;
+  bool prefer_towards_;
+
+  // Tokenizer state
+  uint8_t depth_;
+  bool started_;
+  bool done_;
+  bool in_string_;
+  bool escape_;
+  uint8_t unicode_digits_;  // remaining hex digits of a \uXXXX escape
+  uint16_t unicode_value_;
+  bool expect_key_;
+  bool in_number_;
+  bool negative_;
+  bool fraction_;
+  int32_t number_;
+
+  // Key or value text being captured at arrival level
+  char token_[32];
+  uint8_t token_len_;
+  Field field_;
+
+  // Current arrival
+  ArrivalInfo current_;
+  char towards_[32];
+  bool has_time_;
+  int parsed_;
+};
+
+#endif // TFL_ARRIVALS_H
@@ -0,0 +1,11 @@
+#ifndef THEME_H
+#define THEME_H
+
+// Colors shared by the UI and the asset scripts. Changing PANEL_BG_COLOR
+// falls back to the alpha-blended icons until `make icons` is re-run.
+
+#define BG_GRAD_TOP 0x4c8cb9     // Screen background gradient
+#define BG_GRAD_BOTTOM 0xa6cdec
+#define PANEL_BG_COLOR 0x5e9bc8  // Forecast and transit panels
+
+#endif // THEME_H
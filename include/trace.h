@@ -0,0 +1,38 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Timeline of what the firmware spent its time on, in the Chrome trace
+// event format that chrome://tracing and ui.perfetto.dev load. Spans are
+// recorded into fixed buffers: the ones that finish before trace_boot_done()
+// are kept for good, later ones go round a ring so the most recent refresh
+// cycles are always there. Loop task only.
+
+#define TRACE_BOOT_EVENTS 48
+#define TRACE_RING_EVENTS 128
+#define TRACE_DEPTH 8  // Deepest nesting of trace_begin() spans
+
+// Microseconds since the app started
+uint64_t trace_now_us();
+
+// name must stay valid for good, e.g. a string literal, and contain no quotes
+void trace_begin(const char *name);
+void trace_end();
+void trace_complete(const char *name, uint64_t start_us, uint32_t duration_us);
+
+// End of cold start; later spans go to the ring
+void trace_boot_done();
+
+// Write the trace as JSON, in pieces of up to a few hundred bytes
+typedef void (*TraceSink)(const char *text, size_t len, void *ctx);
+void trace_write_json(TraceSink sink, void *ctx);
+
+// Traces the rest of the enclosing block
+struct TraceScope {
+  explicit TraceScope(const char *name) { trace_begin(name); }
+  ~TraceScope() { trace_end(); }
+};
+
+#endif // TRACE_H
@@ -0,0 +1,43 @@
+#ifndef TRAFFIC_H
+#define TRAFFIC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Per-host tally of the HTTP requests the device makes, so the network cost
+// of a configuration can be read off the device (/metrics, the "traffic"
+// serial command) or a simulated day (make traffic-test on the host, or
+// CONFIG_TRAFFIC_SIM on the device) instead of a packet capture. Every fetch opens its own connection, so each https
+// request is also a TLS handshake. Loop task only.
+
+#define TRAFFIC_HOSTS 6        // Requests to further hosts are only counted
+#define TRAFFIC_HOST_MAX 32    // Longer host names are truncated
+
+struct TrafficHost {
+  char host[TRAFFIC_HOST_MAX];
+  uint32_t requests;
+  uint32_t failures;         // No response, or not 200
+  uint32_t tls_handshakes;
+  uint64_t bytes_out;        // Request line and headers
+  uint64_t bytes_in;         // Response body
+};
+
+// One finished request to url
+void traffic_record(const char *url, uint32_t bytes_out, uint32_t bytes_in, bool ok);
+
+// First-seen order; returns how many there are
+int traffic_hosts(const TrafficHost **hosts);
+
+// Requests to hosts that did not fit in the table
+uint32_t traffic_untracked();
+
+void traffic_clear();
+
+// Table of every host with its totals scaled to a day from elapsed_ms;
+// returns the length
+size_t traffic_format(char *buf, size_t size, uint32_t elapsed_ms);
+
+// Size of the GET request HTTPClient sends for url with useHTTP10(true)
+uint32_t traffic_request_bytes(const char *url);
+
+#endif // TRAFFIC_H
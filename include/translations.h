@@ -49,6 +49,8 @@ struct LocalizedStrings {
   // Sunrise/sunset strings
   const char* sunrise;
   const char* sunset;
+  // Saved locations
+  const char* remove;
 };
 
 #define DEFAULT_CAPTIVE_SSID "Aura"
@@ -84,7 +86,9 @@ static const LocalizedStrings strings_en = {
   "TFL ARRIVALS", "Bus", "Underground", "No arrivals", "min", "Due",
   "Transit Settings", "Bus Stop ID:", "Tube Station:", "e.g. 490008660N",
   // Sunrise/sunset strings
-  "Sunrise", "Sunset"
+  "Sunrise", "Sunset",
+  // Saved locations
+  "Remove"
 };
 
 static const LocalizedStrings strings_es = {
@@ -120,7 +124,9 @@ static const LocalizedStrings strings_es = {
   "LLEGADAS TFL", "Bus", "Metro", "Sin llegadas", "min", "Ahora",
   "Config. Transporte", "ID Parada Bus:", "Estación Metro:", "ej. 490008660N",
   // Sunrise/sunset strings
-  "Amanecer", "Atardecer"
+  "Amanecer", "Atardecer",
+  // Saved locations
+  "Eliminar"
 };
 
 static const LocalizedStrings strings_de = {
@@ -158,7 +164,9 @@ static const LocalizedStrings strings_de = {
   "TFL ANKÜNFTE", "Bus", "U-Bahn", "Keine Ankünfte", "Min", "Jetzt",
   "Verkehr Einst.", "Bus Haltestelle:", "U-Bahn Station:", "z.B. 490008660N",
   // Sunrise/sunset strings
-  "Sonnenaufgang", "Sonnenuntergang"
+  "Sonnenaufgang", "Sonnenuntergang",
+  // Saved locations
+  "Entfernen"
 };
 
 static const LocalizedStrings strings_fr = {
@@ -196,7 +204,9 @@ static const LocalizedStrings strings_fr = {
   "ARRIVÉES TFL", "Bus", "Métro", "Aucune arrivée", "min", "Imminent",
   "Param. Transport", "ID Arrêt Bus:", "Station Métro:", "ex. 490008660N",
   // Sunrise/sunset strings
-  "Lever", "Coucher"
+  "Lever", "Coucher",
+  // Saved locations
+  "Supprimer"
 };
 
 static const LocalizedStrings strings_tr = {
@@ -231,7 +241,9 @@ static const LocalizedStrings strings_tr = {
   "TFL VARIŞLAR", "Otobüs", "Metro", "Variş yok", "dk", "Şimdi",
   "Ulaşım Ayarlari", "Otobüs Duragi:", "Metro İstasyonu:", "örn. 490008660N",
   // Sunrise/sunset strings
-  "Gündoğumu", "Günbatımı"
+  "Gündoğumu", "Günbatımı",
+  // Saved locations
+  "Kaldır"
 };
 
 static const LocalizedStrings strings_sv = {
@@ -270,7 +282,9 @@ static const LocalizedStrings strings_sv = {
   "TFL ANKOMSTER", "Buss", "Tunnelbana", "Inga ankomster", "min", "Nu",
   "Trafikinst.", "Busshållplats:", "T-banestation:", "t.ex. 490008660N",
   // Sunrise/sunset strings
-  "Soluppgång", "Solnedgång"
+  "Soluppgång", "Solnedgång",
+  // Saved locations
+  "Ta bort"
 };
 
 static const LocalizedStrings strings_it = {
@@ -304,7 +318,9 @@ static const LocalizedStrings strings_it = {
   "ARRIVI TFL", "Bus", "Metro", "Nessun arrivo", "min", "In arrivo",
   "Impost. Trasporti", "ID Fermata Bus:", "Stazione Metro:", "es. 490008660N",
   // Sunrise/sunset strings
-  "Alba", "Tramonto"
+  "Alba", "Tramonto",
+  // Saved locations
+  "Rimuovi"
 };
 
 static const LocalizedStrings* get_strings(Language current_language) {
@@ -0,0 +1,207 @@
+// Host check that a refresh makes no heap allocations. malloc, calloc,
+// realloc and operator new are wrapped (-Wl,--wrap) to count calls, and
+// each cycle does what the firmware does around one forecast, transit and
+// location-search refresh without the network:
+//   - the forecast, geocoding and TfL URLs, built as in src/main.cpp;
+//   - the forecast fixture streamed through OpenMeteoParser into models in
+//     the refresh arena, and the TfL fixture through ArrivalParser;
+//   - the hour labels of the hourly panel in every language;
+//   - the log lines of a successful fetch, written to and drained from
+//     the log ring.
+// The first cycle is a warm-up; any allocation after it fails the check.
+//
+//     make alloc-test
+//
+// Only calls from this code and the modules linked with it are counted,
+// not allocations inside the C library itself.
+
+#include <new>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "arena.h"
+#include "log.h"
+#include "open_meteo.h"
+#include "str_builder.h"
+#include "tfl_arrivals.h"
+#include "translations.h"
+
+// As in src/main.cpp
+#define MAX_LOCATIONS 3
+#define REFRESH_ARENA_SIZE (8 * 1024)
+#define FORECAST_URL "http://api.open-meteo.com/v1/forecast"
+#define GEOCODE_URL "https://geocoding-api.open-meteo.com/v1/search"
+#define TFL_STOP_URL "https://api.tfl.gov.uk/StopPoint/"
+#define STREAM_CHUNK 256
+
+#define CYCLES 1000
+
+static uint32_t allocations = 0;
+
+extern "C" void *__real_malloc(size_t size);
+extern "C" void *__real_calloc(size_t n, size_t size);
+extern "C" void *__real_realloc(void *ptr, size_t size);
+
+extern "C" void *__wrap_malloc(size_t size) {
+  allocations++;
+  return __real_malloc(size);
+}
+
+extern "C" void *__wrap_calloc(size_t n, size_t size) {
+  allocations++;
+  return __real_calloc(n, size);
+}
+
+extern "C" void *__wrap_realloc(void *ptr, size_t size) {
+  allocations++;
+  return __real_realloc(ptr, size);
+}
+
+void *operator new(size_t size) {
+  void *ptr = malloc(size);
+  if (!ptr) throw std::bad_alloc();
+  return ptr;
+}
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *ptr) noexcept { free(ptr); }
+void operator delete[](void *ptr) noexcept { free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { free(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { free(ptr); }
+
+struct SavedLocation {
+  const char *latitude;
+  const char *longitude;
+};
+
+static const SavedLocation locations[MAX_LOCATIONS] = {
+  {"51.5085", "-0.1257"}, {"48.8534", "2.3488"}, {"40.7143", "-74.006"},
+};
+static const char *const queries[] = {"San", "São Paulo", "Zürich", "New York", "Ōsaka & Kyōto"};
+static const char *const stops[] = {"490008660N", "490000173RF", "940GZZLUOXC"};
+
+static uint8_t refresh_arena_mem[REFRESH_ARENA_SIZE];
+static Arena refresh_arena(refresh_arena_mem, sizeof(refresh_arena_mem));
+static uint32_t checksum = 0;
+
+static char *read_file(const char *path, size_t *len) {
+  FILE *file = fopen(path, "rb");
+  if (!file) return nullptr;
+  fseek(file, 0, SEEK_END);
+  *len = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  char *body = (char *)__real_malloc(*len);
+  *len = fread(body, 1, *len, file);
+  fclose(file);
+  return body;
+}
+
+template <typename Parser>
+static void stream(Parser &parser, const char *body, size_t len) {
+  for (size_t at = 0; at < len && !parser.complete(); at += STREAM_CHUNK) {
+    parser.feed(body + at, len - at < STREAM_CHUNK ? len - at : STREAM_CHUNK);
+  }
+}
+
+// hour_of_day() in src/main.cpp
+static void hour_of_day(StrBuilder &out, const LocalizedStrings *strings, bool use_24_hour, int hour) {
+  if (use_24_hour) {
+    out.add_int(hour, 2);
+  } else if (hour == 0) {
+    out.add("12").add(strings->am);
+  } else if (hour == 12) {
+    out.add(strings->noon);
+  } else {
+    out.add_int(hour % 12).add(hour < 12 ? strings->am : strings->pm);
+  }
+}
+
+static bool refresh(uint32_t cycle, const char *forecast, size_t forecast_len,
+                    const char *arrivals, size_t arrivals_len) {
+  ArenaScope scratch(refresh_arena);
+
+  StackStr<512> url;
+  url.add(FORECAST_URL "?latitude=");
+  for (int i = 0; i < MAX_LOCATIONS; i++) {
+    if (i) url.add(',');
+    url.add(locations[i].latitude);
+  }
+  url.add("&longitude=");
+  for (int i = 0; i < MAX_LOCATIONS; i++) {
+    if (i) url.add(',');
+    url.add(locations[i].longitude);
+  }
+  url.add("&current=temperature_2m,apparent_temperature,is_day,weather_code")
+     .add("&daily=temperature_2m_min,temperature_2m_max,weather_code,sunrise,sunset")
+     .add("&hourly=temperature_2m,precipitation_probability,precipitation,is_day,weather_code")
+     .add("&forecast_days=7")
+     .add("&forecast_hours=7")
+     .add("&timeformat=unixtime")
+     .add(cycle & 1 ? "&temperature_unit=fahrenheit&precipitation_unit=inch" : "")
+     .add("&timezone=auto");
+
+  WeatherModel *models = (WeatherModel *)refresh_arena.alloc(sizeof(WeatherModel) * MAX_LOCATIONS);
+  if (!models) return false;
+  OpenMeteoParser parser(models, MAX_LOCATIONS);
+  stream(parser, forecast, forecast_len);
+  if (parser.parsed() != MAX_LOCATIONS) return false;
+  LOG_I("Updated weather from open-meteo: %s", url.c_str());
+
+  for (int lang = LANG_EN; lang <= LANG_IT; lang++) {
+    const LocalizedStrings *strings = get_strings((Language)lang);
+    for (int i = 0; i < FORECAST_HOURS; i++) {
+      StackStr<16> hour;
+      hour_of_day(hour, strings, cycle & 2, local_hour(models[0].hourly[i].time, models[0].utc_offset_seconds));
+      checksum += hour.length();
+    }
+  }
+
+  StackStr<160> geocode;
+  geocode.add(GEOCODE_URL "?name=").add_urlencoded(queries[cycle % 5]).add("&count=15");
+  LOG_I("Completed location search at open-meteo: %s", geocode.c_str());
+
+  ArrivalTopK top;
+  ArrivalParser arrival_parser(top, true);
+  for (const char *stop : stops) {
+    StackStr<96> tfl;
+    tfl.add(TFL_STOP_URL).add(stop).add("/Arrivals");
+    arrival_parser.reset();
+    stream(arrival_parser, arrivals, arrivals_len);
+    if (!arrival_parser.complete()) return false;
+    log_write(LOG_LEVEL_DEBUG, "Fetched tube arrivals from TfL: %s", tfl.c_str());  // LOG_D, compiled out by default
+  }
+  ArrivalInfo shown[ARRIVALS_SHOWN];
+  checksum += top.take_sorted(shown);
+
+  char line[LOG_LINE_MAX];
+  int level;
+  while (log_pop(line, sizeof(line), &level) > 0) checksum += line[0];
+  return !url.truncated() && !geocode.truncated();
+}
+
+int main() {
+  size_t forecast_len, arrivals_len;
+  char *forecast = read_file("scripts/fixtures/forecast/3-locations.json", &forecast_len);
+  char *arrivals = read_file("scripts/fixtures/arrivals/940GZZLUOXC.json", &arrivals_len);
+  if (!forecast || !arrivals) {
+    printf("Fixtures missing from scripts/fixtures\n");
+    return 1;
+  }
+
+  log_init();
+  for (uint32_t cycle = 0; cycle < CYCLES; cycle++) {
+    uint32_t before = allocations;
+    if (!refresh(cycle, forecast, forecast_len, arrivals, arrivals_len)) {
+      printf("Cycle %u: a fixture did not parse or a URL did not fit\n", cycle);
+      return 1;
+    }
+    if (cycle == 0) {
+      printf("Warm-up refresh: %u heap allocations\n", allocations - before);
+    } else if (allocations != before) {
+      printf("FAIL: refresh %u made %u heap allocations\n", cycle, allocations - before);
+      return 1;
+    }
+  }
+  printf("%d refreshes after warm-up: 0 heap allocations (checksum %08x)\n", CYCLES - 1, checksum);
+  return 0;
+}
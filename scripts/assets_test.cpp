@@ -0,0 +1,169 @@
+// Host check of assets_bind() (src/assets.cpp) against the blob that
+// scripts/build_assets.py packs. The good blob must bind, with every image
+// inside it, also from a partition larger than the blob. Everything else
+// must be refused and leave no image bound:
+//   - the blob truncated at every length;
+//   - every header byte and every index byte corrupted, and one bit in
+//     each of a spread of pixel bytes (caught by the CRC);
+//   - headers and index entries that are wrong but carry a valid CRC, as a
+//     blob from another packer version or asset_ids.h would.
+//
+//     make assets-test
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+#include "assets.h"
+
+#define DATA_SAMPLES 256
+
+static int failures = 0;
+
+static void expect(bool ok, const char *what, size_t where) {
+  if (ok) return;
+  if (failures++ < 20) printf("FAIL: %s (byte %zu)\n", what, where);
+}
+
+static bool nothing_bound() {
+  for (int i = 0; i < ASSET_COUNT; i++) {
+    if (asset_image((AssetId)i)) return false;
+  }
+  return true;
+}
+
+// Bind a copy of blob, so a bind that wrongly succeeds cannot point into
+// memory the next case reuses
+static bool bind_copy(const uint8_t *blob, size_t size) {
+  static uint8_t *copy = nullptr;
+  free(copy);
+  copy = (uint8_t *)malloc(size ? size : 1);
+  memcpy(copy, blob, size);
+  return assets_bind(copy, size);
+}
+
+static void expect_refused(const uint8_t *blob, size_t size, const char *what, size_t where) {
+  bool bound = bind_copy(blob, size);
+  expect(!bound && nothing_bound(), what, where);
+}
+
+// Recompute the CRC after editing the blob, as a consistent packer would
+static void reseal(uint8_t *blob) {
+  AssetHeader header;
+  memcpy(&header, blob, sizeof(header));
+  header.crc32 = crc32(0, blob + sizeof(header), header.size - sizeof(header));
+  memcpy(blob, &header, sizeof(header));
+}
+
+template <typename Edit>
+static void expect_sealed_refused(const uint8_t *blob, size_t size, const char *what, Edit edit) {
+  uint8_t *bad = (uint8_t *)malloc(size);
+  memcpy(bad, blob, size);
+  edit(bad);
+  reseal(bad);
+  expect_refused(bad, size, what, 0);
+  free(bad);
+}
+
+static void edit_entry(uint8_t *blob, int index, void (*change)(AssetEntry &)) {
+  AssetEntry entry;
+  uint8_t *at = blob + sizeof(AssetHeader) + index * sizeof(AssetEntry);
+  memcpy(&entry, at, sizeof(entry));
+  change(entry);
+  memcpy(at, &entry, sizeof(entry));
+}
+
+static void edit_header(uint8_t *blob, void (*change)(AssetHeader &)) {
+  AssetHeader header;
+  memcpy(&header, blob, sizeof(header));
+  change(header);
+  memcpy(blob, &header, sizeof(header));
+}
+
+int main(int argc, char **argv) {
+  const char *path = argc > 1 ? argv[1] : ".pio/assets.bin";
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    printf("Cannot open %s; run make assets\n", path);
+    return 1;
+  }
+  fseek(file, 0, SEEK_END);
+  size_t size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  uint8_t *blob = (uint8_t *)malloc(size + 4096);
+  size = fread(blob, 1, size, file);
+  fclose(file);
+  size_t table_end = sizeof(AssetHeader) + ASSET_COUNT * sizeof(AssetEntry);
+
+  // The good blob, then the same blob at the start of a larger partition
+  memset(blob + size, 0xFF, 4096);
+  const size_t partitions[] = {size, size + 4096};
+  for (size_t partition : partitions) {
+    bool bound = assets_bind(blob, partition);
+    expect(bound, "packed blob refused", partition);
+    for (int i = 0; bound && i < ASSET_COUNT; i++) {
+      const lv_img_dsc_t *img = asset_image((AssetId)i);
+      bool inside = img && img->data >= blob + table_end && img->data + img->data_size <= blob + size;
+      expect(inside && img->header.w && img->header.h &&
+             (size_t)img->header.stride * img->header.h <= img->data_size, "image outside the blob", i);
+    }
+  }
+
+  // A refused bind must unbind what was bound before
+  assets_bind(blob, size);
+  expect_refused(blob, 0, "empty blob bound", 0);
+
+  int cases = 0;
+  for (size_t len = 0; len < size; len++, cases++) {
+    expect(!assets_bind(blob, len) && nothing_bound(), "truncated blob bound", len);
+  }
+
+  uint8_t *bad = (uint8_t *)malloc(size);
+  memcpy(bad, blob, size);
+  for (size_t at = 0; at < table_end; at++, cases++) {
+    bad[at] ^= 1 << (at % 8);
+    expect_refused(bad, size, "corrupt header or index bound", at);
+    bad[at] = blob[at];
+  }
+  for (int i = 0; i < DATA_SAMPLES; i++, cases++) {
+    size_t at = table_end + (size - table_end) * i / DATA_SAMPLES;
+    bad[at] ^= 1 << (i % 8);
+    expect_refused(bad, size, "corrupt pixels bound", at);
+    bad[at] = blob[at];
+  }
+  free(bad);
+
+  expect_sealed_refused(blob, size, "other version bound", [](uint8_t *b) {
+    edit_header(b, [](AssetHeader &h) { h.version++; });
+  });
+  expect_sealed_refused(blob, size, "other asset_ids.h bound", [](uint8_t *b) {
+    edit_header(b, [](AssetHeader &h) { h.table_hash ^= 1; });
+  });
+  expect_sealed_refused(blob, size, "other image count bound", [](uint8_t *b) {
+    edit_header(b, [](AssetHeader &h) { h.count--; });
+  });
+  expect_sealed_refused(blob, size, "header without room for the index bound", [](uint8_t *b) {
+    edit_header(b, [](AssetHeader &h) { h.size = sizeof(AssetHeader) + 4; });
+  });
+  expect_sealed_refused(blob, size, "image past the end bound", [](uint8_t *b) {
+    edit_entry(b, ASSET_COUNT - 1, [](AssetEntry &e) { e.size += 4; });
+  });
+  expect_sealed_refused(blob, size, "image offset past the end bound", [](uint8_t *b) {
+    edit_entry(b, 0, [](AssetEntry &e) { e.offset = 0xFFFFFFF0U; });
+  });
+  expect_sealed_refused(blob, size, "image larger than its data bound", [](uint8_t *b) {
+    edit_entry(b, 0, [](AssetEntry &e) { e.h++; });
+  });
+  expect_sealed_refused(blob, size, "misaligned image bound", [](uint8_t *b) {
+    edit_entry(b, 0, [](AssetEntry &e) { e.offset += 2; });
+  });
+  cases += 8;
+
+  if (failures) {
+    printf("%d of %d cases failed\n", failures, cases);
+    return 1;
+  }
+  printf("%s: %zu bytes, %d images bound; %d truncated, corrupt or inconsistent blobs refused\n",
+         path, size, ASSET_COUNT, cases);
+  return 0;
+}
@@ -0,0 +1,276 @@
+// Host check of the RGB565 kernels in src/lv_blend_aura.c: compares each
+// one against a per-pixel reference of LVGL's arithmetic over random sizes,
+// alignments and strides, then times both on a 64x64 area. The masked
+// kernels are timed over the alpha planes of the images given on the
+// command line.
+//
+//     make blend-test
+//
+// With LVGL available (LVGL_DIR, .pio/libdeps/esp32dev/lvgl after a build)
+// the reference mixes with LVGL's own lv_color_16_16_mix() rather than the
+// copy below.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "lv_blend_aura.h"
+
+#define CASES 2000
+#define MAX_W 70
+#define MAX_H 8
+#define PAD 8           // Pixels of slack around every row
+
+#ifdef BLEND_TEST_LVGL
+#include "src/misc/lv_color.h"
+#define ref_mix lv_color_16_16_mix
+#else
+// lv_color_16_16_mix() from LVGL 9.2
+static uint16_t ref_mix(uint16_t c1, uint16_t c2, uint8_t mix) {
+  if (mix == 255) return c1;
+  if (mix == 0) return c2;
+  if (c1 == c2) return c1;
+  mix = (uint32_t)((uint32_t)mix + 4) >> 3;
+  uint32_t bg = (uint32_t)(c2 | ((uint32_t)c2 << 16)) & 0x7E0F81F;
+  uint32_t fg = (uint32_t)(c1 | ((uint32_t)c1 << 16)) & 0x7E0F81F;
+  uint32_t result = ((((fg - bg) * mix) >> 5) + bg) & 0x7E0F81F;
+  return (uint16_t)(result >> 16) | result;
+}
+#endif
+
+#define ROW(p, stride, y) ((void *)((uint8_t *)(p) + (size_t)(y) * (stride)))
+#define CONST_ROW(p, stride, y) ((const void *)((const uint8_t *)(p) + (size_t)(y) * (stride)))
+
+static void ref_fill(uint16_t *dest, int32_t w, int32_t h, int32_t dest_stride, uint16_t color) {
+  for (int32_t y = 0; y < h; y++) {
+    uint16_t *d = ROW(dest, dest_stride, y);
+    for (int32_t x = 0; x < w; x++) d[x] = color;
+  }
+}
+
+static void ref_fill_opa(uint16_t *dest, int32_t w, int32_t h, int32_t dest_stride, uint16_t color, uint8_t opa) {
+  for (int32_t y = 0; y < h; y++) {
+    uint16_t *d = ROW(dest, dest_stride, y);
+    for (int32_t x = 0; x < w; x++) d[x] = ref_mix(color, d[x], opa);
+  }
+}
+
+static void ref_fill_mask(uint16_t *dest, int32_t w, int32_t h, int32_t dest_stride, uint16_t color,
+                          const uint8_t *mask, int32_t mask_stride) {
+  for (int32_t y = 0; y < h; y++) {
+    uint16_t *d = ROW(dest, dest_stride, y);
+    const uint8_t *m = CONST_ROW(mask, mask_stride, y);
+    for (int32_t x = 0; x < w; x++) d[x] = ref_mix(color, d[x], m[x]);
+  }
+}
+
+static void ref_blit(uint16_t *dest, int32_t w, int32_t h, int32_t dest_stride, const uint16_t *src,
+                     int32_t src_stride) {
+  for (int32_t y = 0; y < h; y++) {
+    uint16_t *d = ROW(dest, dest_stride, y);
+    const uint16_t *s = CONST_ROW(src, src_stride, y);
+    for (int32_t x = 0; x < w; x++) d[x] = s[x];
+  }
+}
+
+static void ref_blit_mask(uint16_t *dest, int32_t w, int32_t h, int32_t dest_stride, const uint16_t *src,
+                          int32_t src_stride, const uint8_t *mask, int32_t mask_stride) {
+  for (int32_t y = 0; y < h; y++) {
+    uint16_t *d = ROW(dest, dest_stride, y);
+    const uint16_t *s = CONST_ROW(src, src_stride, y);
+    const uint8_t *m = CONST_ROW(mask, mask_stride, y);
+    for (int32_t x = 0; x < w; x++) d[x] = ref_mix(s[x], d[x], m[x]);
+  }
+}
+
+// Alignment matters to the kernels, so buffers are word aligned and the
+// areas start at a chosen pixel offset into them
+static uint16_t dest_a[(MAX_W + PAD) * MAX_H + PAD] __attribute__((aligned(4)));
+static uint16_t dest_b[(MAX_W + PAD) * MAX_H + PAD] __attribute__((aligned(4)));
+static uint16_t src[(MAX_W + PAD) * MAX_H + PAD] __attribute__((aligned(4)));
+static uint8_t mask[(MAX_W + PAD) * MAX_H + PAD] __attribute__((aligned(4)));
+
+static uint16_t random_color(void) {
+  return (uint16_t)(rand() & 0xFFFF);
+}
+
+// Mostly fully transparent or opaque, like glyph and icon edges
+static uint8_t random_mask(void) {
+  int r = rand() % 4;
+  return r == 0 ? 0 : r == 1 ? 255 : (uint8_t)rand();
+}
+
+static void fill_random(void) {
+  // Half the destinations are uniform, which the opacity fill caches
+  uint16_t bg = random_color();
+  int uniform = rand() & 1;
+  for (size_t i = 0; i < sizeof(dest_a) / 2; i++) dest_a[i] = uniform ? bg : random_color();
+  memcpy(dest_b, dest_a, sizeof(dest_a));
+  for (size_t i = 0; i < sizeof(src) / 2; i++) src[i] = random_color();
+  for (size_t i = 0; i < sizeof(mask); i++) mask[i] = random_mask();
+}
+
+static int check(void) {
+  int failures = 0;
+  for (int i = 0; i < CASES; i++) {
+    fill_random();
+    int kernel = i % 5;
+    int32_t w = 1 + rand() % MAX_W;
+    int32_t h = 1 + rand() % MAX_H;
+    int32_t dest_off = rand() % 2;
+    int32_t src_off = rand() % 2;
+    int32_t mask_off = rand() % 4;
+    int32_t dest_stride = (w + dest_off + rand() % (PAD - 1)) * 2;
+    int32_t src_stride = (w + src_off + rand() % (PAD - 1)) * 2;
+    int32_t mask_stride = w + mask_off + rand() % (PAD - 3);
+    if (rand() % 4 == 0) src_stride = dest_stride;  // The one-memcpy blit
+    uint16_t color = random_color();
+    uint8_t opa = (uint8_t)rand();
+
+    uint16_t *da = dest_a + dest_off;
+    uint16_t *db = dest_b + dest_off;
+    const uint16_t *s = src + src_off;
+    const uint8_t *m = mask + mask_off;
+    const char *name = "";
+    switch (kernel) {
+      case 0:
+        name = "fill";
+        ref_fill(da, w, h, dest_stride, color);
+        aura_fill_rgb565(db, w, h, dest_stride, color);
+        break;
+      case 1:
+        name = "fill_opa";
+        ref_fill_opa(da, w, h, dest_stride, color, opa);
+        aura_fill_rgb565_opa(db, w, h, dest_stride, color, opa);
+        break;
+      case 2:
+        name = "fill_mask";
+        ref_fill_mask(da, w, h, dest_stride, color, m, mask_stride);
+        aura_fill_rgb565_mask(db, w, h, dest_stride, color, m, mask_stride);
+        break;
+      case 3:
+        name = "blit";
+        ref_blit(da, w, h, dest_stride, s, src_stride);
+        aura_blit_rgb565(db, w, h, dest_stride, s, src_stride);
+        break;
+      case 4:
+        name = "blit_mask";
+        ref_blit_mask(da, w, h, dest_stride, s, src_stride, m, mask_stride);
+        aura_blit_rgb565_mask(db, w, h, dest_stride, s, src_stride, m, mask_stride);
+        break;
+    }
+
+    // Also catches writes past the area
+    if (memcmp(dest_a, dest_b, sizeof(dest_a)) != 0) {
+      printf("FAIL %s case %d: w=%d h=%d dest+%d src+%d mask+%d\n", name, i, (int)w, (int)h, (int)dest_off,
+             (int)src_off, (int)mask_off);
+      failures++;
+    }
+  }
+  return failures;
+}
+
+static double now_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+#define N 64  // The weather images are 64x64 RGB565A8
+#define BG 0x2104
+
+static uint16_t bench_dest[N * N] __attribute__((aligned(4)));
+static uint16_t bench_src[N * N] __attribute__((aligned(4)));
+static uint8_t bench_mask[N * N] __attribute__((aligned(4)));
+
+// Pixels then alpha plane of an LVGL image source file, e.g. assets/image_sunny.c
+static int load_image(const char *path) {
+  FILE *f = fopen(path, "r");
+  if (!f) return 0;
+  static uint8_t data[N * N * 3];
+  size_t n = 0;
+  char tok[8];
+  int c, in_map = 0;
+  while ((c = fgetc(f)) != EOF && n < sizeof(data)) {
+    if (!in_map) {
+      in_map = c == '{';
+      continue;
+    }
+    if (c == '}') break;
+    if (c == '0' && fscanf(f, "%6[xX0-9a-fA-F]", tok) == 1) data[n++] = (uint8_t)strtoul(tok + 1, NULL, 16);
+  }
+  fclose(f);
+  if (n != sizeof(data)) return 0;
+  memcpy(bench_src, data, N * N * 2);
+  memcpy(bench_mask, data + N * N * 2, N * N);
+  return 1;
+}
+
+// Best of a few runs, each call on a fresh background so repeated blends
+// do not converge
+#define TIME(call) ({                                         \
+    double best = 1e9;                                        \
+    for (int run = 0; run < 5; run++) {                       \
+      double total = 0;                                       \
+      for (int r = 0; r < ROUNDS; r++) {                      \
+        for (int i = 0; i < N * N; i++) bench_dest[i] = BG;   \
+        double start = now_us();                              \
+        call;                                                 \
+        __asm__ volatile("" : : "r"(bench_dest) : "memory");  \
+        total += now_us() - start;                            \
+      }                                                       \
+      if (total < best) best = total;                         \
+    }                                                         \
+    best / ROUNDS;                                            \
+  })
+#define ROUNDS 2000
+
+static void bench(int images, char **paths) {
+  const int32_t stride = N * 2;
+  for (int i = 0; i < N * N; i++) bench_src[i] = random_color();
+
+  printf("%dx%d, us per call:     reference  kernel\n", N, N);
+  printf("  fill             %9.2f %7.2f\n", TIME(ref_fill(bench_dest, N, N, stride, 0xFFFF)),
+         TIME(aura_fill_rgb565(bench_dest, N, N, stride, 0xFFFF)));
+  printf("  fill_opa         %9.2f %7.2f\n", TIME(ref_fill_opa(bench_dest, N, N, stride, 0xFFFF, 128)),
+         TIME(aura_fill_rgb565_opa(bench_dest, N, N, stride, 0xFFFF, 128)));
+  printf("  blit             %9.2f %7.2f\n", TIME(ref_blit(bench_dest, N, N, stride, bench_src, stride)),
+         TIME(aura_blit_rgb565(bench_dest, N, N, stride, bench_src, stride)));
+
+  // The masked paths depend on how much of the mask is opaque, transparent
+  // or edge, so they run over the real images' alpha planes
+  double ref_fm = 0, aura_fm = 0, ref_bm = 0, aura_bm = 0;
+  int loaded = 0;
+  for (int i = 0; i < images; i++) {
+    if (!load_image(paths[i])) {
+      printf("  skipping %s: not a %dx%d RGB565A8 image\n", paths[i], N, N);
+      continue;
+    }
+    ref_fm += TIME(ref_fill_mask(bench_dest, N, N, stride, 0xFFFF, bench_mask, N));
+    aura_fm += TIME(aura_fill_rgb565_mask(bench_dest, N, N, stride, 0xFFFF, bench_mask, N));
+    ref_bm += TIME(ref_blit_mask(bench_dest, N, N, stride, bench_src, stride, bench_mask, N));
+    aura_bm += TIME(aura_blit_rgb565_mask(bench_dest, N, N, stride, bench_src, stride, bench_mask, N));
+    loaded++;
+  }
+  if (loaded) {
+    printf("  fill_mask        %9.2f %7.2f   mean over %d images\n", ref_fm / loaded, aura_fm / loaded, loaded);
+    printf("  blit_mask        %9.2f %7.2f   mean over %d images\n", ref_bm / loaded, aura_bm / loaded, loaded);
+  }
+}
+
+int main(int argc, char **argv) {
+  srand(1);
+  int failures = check();
+  if (failures) {
+    printf("%d of %d cases differ\n", failures, CASES);
+    return 1;
+  }
+#ifdef BLEND_TEST_LVGL
+  printf("%d cases identical to LVGL's mix\n", CASES);
+#else
+  printf("%d cases identical\n", CASES);
+#endif
+  bench(argc - 1, argv + 1);
+  return 0;
+}
@@ -0,0 +1,180 @@
+#!/usr/bin/env python3
+"""
+Pack the weather images into the blob flashed to the "assets" partition.
+
+Reads every LVGL image in assets/*.c, writes .pio/assets.bin (header, index,
+then the 4-byte aligned pixel data) and regenerates include/asset_ids.h with
+the matching AssetId enum. The layout is described in include/assets.h.
+
+    python scripts/build_assets.py            pack and write asset_ids.h
+    python scripts/build_assets.py --verify   check .pio/assets.bin (or a given path)
+    python scripts/build_assets.py --offset   print the partition offset for flashing
+"""
+
+import re
+import struct
+import sys
+import zlib
+from pathlib import Path
+
+ASSET_MAGIC = 0x54455341  # "ASET"
+ASSET_VERSION = 1
+HEADER = struct.Struct("<IHHIII")
+ENTRY = struct.Struct("<IIHHHBB")
+
+PARTITION_LABEL = "assets"
+
+# lv_color_format_t values of the formats resize_images.py writes, with the
+# bytes each pixel takes across all planes
+COLOR_FORMATS = {
+    "LV_COLOR_FORMAT_RGB565": (0x12, 2),
+    "LV_COLOR_FORMAT_RGB565A8": (0x14, 3),
+}
+
+
+def load_images(assets_dir: Path) -> dict:
+    """Name -> (cf, w, h, stride, data) for every lv_image_dsc_t in assets_dir."""
+    images = {}
+    for path in sorted(assets_dir.glob("*.c")):
+        text = path.read_text()
+        maps = {m.group(1): m.group(2) for m in re.finditer(r"uint8_t (\w+)_map\[\] = \{(.*?)\};", text, re.S)}
+        for m in re.finditer(r"const lv_image_dsc_t (\w+) = \{(.*?)\};", text, re.S):
+            name, body = m.group(1), m.group(2)
+
+            def field(key):
+                return re.search(r"\.header\." + key + r" = (\w+)", body).group(1)
+
+            cf_name, w, h, stride = field("cf"), int(field("w")), int(field("h")), int(field("stride"))
+            if cf_name not in COLOR_FORMATS:
+                raise ValueError(f"{path.name}: {name} uses unsupported format {cf_name}")
+            cf, bpp = COLOR_FORMATS[cf_name]
+            data = bytes(int(v, 16) for v in re.findall(r"0x([0-9a-fA-F]{2})", maps[name]))
+            if len(data) != w * h * bpp:
+                raise ValueError(f"{path.name}: {name} has {len(data)} bytes, expected {w * h * bpp}")
+            images[name] = (cf, w, h, stride, data)
+    return images
+
+
+def read_blend_color(assets_dir: Path) -> int:
+    """Panel color the *_on_panel icons were pre-blended onto."""
+    text = (assets_dir / "icons_on_panel.c").read_text()
+    return int(re.search(r"#define ICON_PANEL_BLEND_COLOR (0x[0-9a-fA-F]+)", text).group(1), 16)
+
+
+def table_hash(names: list, blend_color: int) -> int:
+    """Identifies the id table, so firmware never binds a blob packed for another."""
+    return zlib.crc32(("\n".join(names) + f"\nblend=0x{blend_color:06x}").encode())
+
+
+def pack(images: dict, table: int) -> bytes:
+    names = sorted(images)
+    offset = HEADER.size + ENTRY.size * len(names)
+    entries = bytearray()
+    data = bytearray()
+    for name in names:
+        cf, w, h, stride, pixels = images[name]
+        offset = (offset + 3) & ~3
+        data += bytes(offset - HEADER.size - ENTRY.size * len(names) - len(data))
+        entries += ENTRY.pack(offset, len(pixels), w, h, stride, cf, 0)
+        data += pixels
+        offset += len(pixels)
+
+    body = bytes(entries) + bytes(data)
+    header = HEADER.pack(ASSET_MAGIC, ASSET_VERSION, len(names), table, HEADER.size + len(body), zlib.crc32(body))
+    return header + body
+
+
+def write_ids(names: list, table: int, blend_color: int, path: Path):
+    lines = [
+        "#ifndef ASSET_IDS_H",
+        "#define ASSET_IDS_H",
+        "",
+        "// Index of the images in the asset partition - generated by",
+        "// scripts/build_assets.py, do not edit",
+        "",
+        f"#define ASSET_TABLE_HASH 0x{table:08x}U",
+        f"#define ASSET_PANEL_BLEND_COLOR 0x{blend_color:06x}",
+        "",
+        "enum AssetId {",
+    ]
+    lines += [f"  ASSET_{name}," for name in names]
+    lines += ["  ASSET_COUNT", "};", "", "#endif // ASSET_IDS_H", ""]
+    path.write_text("\n".join(lines))
+
+
+def partition_offset(project_root: Path):
+    """Offset and size of the assets partition in partitions.csv."""
+    for line in (project_root / "partitions.csv").read_text().splitlines():
+        fields = [f.strip() for f in line.split("#")[0].split(",")]
+        if fields[0] == PARTITION_LABEL:
+            return int(fields[3], 0), int(fields[4], 0)
+    raise ValueError(f"No {PARTITION_LABEL} partition in partitions.csv")
+
+
+def verify(blob: bytes, ids_header: Path, images: dict) -> list:
+    """Everything wrong with blob; empty if it is good."""
+    if len(blob) < HEADER.size:
+        return ["shorter than the header"]
+    magic, version, count, table, size, crc = HEADER.unpack_from(blob)
+    if magic != ASSET_MAGIC or version != ASSET_VERSION:
+        return [f"bad magic 0x{magic:08x} or version {version}"]
+
+    errors = []
+    if size != len(blob):
+        errors.append(f"header says {size} bytes, file has {len(blob)}")
+    if zlib.crc32(blob[HEADER.size:size]) != crc:
+        errors.append("CRC mismatch")
+    expected = int(re.search(r"ASSET_TABLE_HASH (0x[0-9a-f]+)", ids_header.read_text()).group(1), 16)
+    if table != expected:
+        errors.append(f"packed for table 0x{table:08x}, {ids_header.name} has 0x{expected:08x}")
+    if count != len(images):
+        errors.append(f"{count} images, assets/ has {len(images)}")
+
+    for i, name in enumerate(sorted(images)[:count]):
+        offset, length, w, h, stride, cf, _ = ENTRY.unpack_from(blob, HEADER.size + i * ENTRY.size)
+        if offset % 4 or offset + length > len(blob):
+            errors.append(f"{name}: bad offset {offset} or size {length}")
+        elif (cf, w, h, stride, blob[offset:offset + length]) != images[name]:
+            errors.append(f"{name}: differs from assets/")
+    return errors
+
+
+def main():
+    project_root = Path(__file__).resolve().parent.parent
+    assets_dir = project_root / "assets"
+    ids_header = project_root / "include" / "asset_ids.h"
+    blob_path = project_root / ".pio" / "assets.bin"
+
+    if "--offset" in sys.argv:
+        print(f"0x{partition_offset(project_root)[0]:x}")
+        return
+
+    images = load_images(assets_dir)
+
+    if "--verify" in sys.argv:
+        args = [a for a in sys.argv[1:] if not a.startswith("--")]
+        path = Path(args[0]) if args else blob_path
+        errors = verify(path.read_bytes(), ids_header, images)
+        for error in errors:
+            print(f"  {path.name}: {error}")
+        print(f"{path.name}: {'FAILED' if errors else 'OK'} ({len(images)} images)")
+        sys.exit(1 if errors else 0)
+
+    blend_color = read_blend_color(assets_dir)
+    names = sorted(images)
+    table = table_hash(names, blend_color)
+    blob = pack(images, table)
+
+    _, capacity = partition_offset(project_root)
+    if len(blob) > capacity:
+        raise SystemExit(f"Asset blob is {len(blob)} bytes but the partition holds {capacity}")
+
+    blob_path.parent.mkdir(exist_ok=True)
+    blob_path.write_bytes(blob)
+    write_ids(names, table, blend_color, ids_header)
+    print(f"Packed {len(names)} images into {blob_path.relative_to(project_root)}: "
+          f"{len(blob) / 1024:.1f} of {capacity / 1024:.0f} KB")
+
+
+if __name__ == "__main__":
+    main()
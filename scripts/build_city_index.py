@@ -0,0 +1,241 @@
+#!/usr/bin/env python3
+"""
+Generate the offline city index used by the location search.
+
+Reads the GeoNames city dump (cities with population > 15000) and writes
+src/city_index_data.c: a name-sorted table of compact city records plus a
+deduplicated string pool, so location search works instantly and offline.
+
+Usable standalone (python scripts/build_city_index.py) or as a PlatformIO
+pre-build script. The index is reused until this script or
+AURA_CITY_MIN_POPULATION changes. If the GeoNames data cannot be downloaded
+an empty index is written and the firmware falls back to the online
+geocoding API; later builds keep it and warn instead of retrying the
+download, until make cities (--force) is run with network access.
+"""
+
+import io
+import os
+import sys
+import unicodedata
+import urllib.request
+import zipfile
+from pathlib import Path
+
+GEONAMES_BASE = "https://download.geonames.org/export/dump"
+CITIES_ARCHIVE = "cities15000.zip"
+CITIES_FILE = "cities15000.txt"
+ADMIN1_FILE = "admin1CodesASCII.txt"
+
+# Keep the table small enough for the app partition; override with the
+# AURA_CITY_MIN_POPULATION environment variable.
+DEFAULT_MIN_POPULATION = 100000
+
+# Must match CITY_KEY_MAX in include/city_index.h
+KEY_MAX = 63
+
+# Latin-1 Supplement and Latin Extended-A are folded to ASCII for search
+FOLD_FIRST = 0xC0
+FOLD_LAST = 0x17F
+FOLD_SPECIAL = {
+    "ß": "s", "æ": "a", "Æ": "a", "ø": "o", "Ø": "o", "đ": "d", "Đ": "d",
+    "ð": "d", "Ð": "d", "ł": "l", "Ł": "l", "ħ": "h", "Ħ": "h", "ı": "i",
+    "œ": "o", "Œ": "o", "þ": "t", "Þ": "t", "ŀ": "l", "Ŀ": "l", "ŧ": "t",
+    "Ŧ": "t", "ĸ": "k", "ŉ": "n", "ŋ": "n", "Ŋ": "n",
+}
+
+
+def download(url: str, path: Path) -> bool:
+    """Download url to path, returning False on any network error."""
+    try:
+        with urllib.request.urlopen(url, timeout=30) as response:
+            path.write_bytes(response.read())
+        return True
+    except Exception as e:
+        print(f"  Error downloading {url}: {e}")
+        return False
+
+
+def build_fold_table() -> list:
+    """Map each code point in the fold range to a lowercase ASCII letter, or 0."""
+    table = []
+    for cp in range(FOLD_FIRST, FOLD_LAST + 1):
+        ch = chr(cp)
+        base = FOLD_SPECIAL.get(ch)
+        if base is None:
+            decomposed = unicodedata.normalize("NFD", ch)[0]
+            base = decomposed.lower() if decomposed.isascii() and decomposed.isalpha() else None
+        table.append(ord(base) if base else 0)
+    return table
+
+
+def fold(name: str, table: list) -> bytes:
+    """Search key for name; mirrors city_fold() in src/city_index.cpp."""
+    out = bytearray()
+    for ch in name:
+        cp = ord(ch)
+        if cp < 0x80:
+            out += ch.lower().encode("ascii")
+        elif FOLD_FIRST <= cp <= FOLD_LAST and table[cp - FOLD_FIRST]:
+            out.append(table[cp - FOLD_FIRST])
+        else:
+            out += ch.encode("utf-8")
+    return bytes(out[:KEY_MAX])
+
+
+def c_string(raw: bytes) -> str:
+    """Escape raw bytes as a C string literal without ambiguous escapes."""
+    parts = []
+    for b in raw:
+        if b in (0x22, 0x5C):
+            parts.append("\\" + chr(b))
+        elif 0x20 <= b < 0x7F:
+            parts.append(chr(b))
+        else:
+            parts.append(f"\\{b:03o}")
+    return '"' + "".join(parts) + '"'
+
+
+def load_admin1(path: Path) -> dict:
+    names = {}
+    if not path.exists():
+        return names
+    for line in path.read_text(encoding="utf-8").splitlines():
+        fields = line.split("\t")
+        if len(fields) >= 2:
+            names[fields[0]] = fields[1]
+    return names
+
+
+def load_cities(cache_dir: Path, min_population: int) -> list:
+    archive = cache_dir / CITIES_ARCHIVE
+    admin1_path = cache_dir / ADMIN1_FILE
+    if not archive.exists() and not download(f"{GEONAMES_BASE}/{CITIES_ARCHIVE}", archive):
+        return []
+    if not admin1_path.exists():
+        download(f"{GEONAMES_BASE}/{ADMIN1_FILE}", admin1_path)
+
+    admin1 = load_admin1(admin1_path)
+    cities = []
+    with zipfile.ZipFile(archive) as zf:
+        with zf.open(CITIES_FILE) as f:
+            for line in io.TextIOWrapper(f, encoding="utf-8"):
+                fields = line.rstrip("\n").split("\t")
+                population = int(fields[14] or 0)
+                if population < min_population:
+                    continue
+                cities.append({
+                    "name": fields[1],
+                    "admin1": admin1.get(f"{fields[8]}.{fields[10]}"),
+                    "lat": round(float(fields[4]) * 100000),
+                    "lon": round(float(fields[5]) * 100000),
+                    "population": population,
+                })
+    return cities
+
+
+def generate(cities: list, table: list, output_path: Path, min_population: int) -> int:
+    """Write the C table and return the flash footprint in bytes."""
+    cities.sort(key=lambda c: (fold(c["name"], table), -c["population"]))
+
+    pool = bytearray()
+    pool_ofs = {}
+
+    def intern(s: str) -> int:
+        if s not in pool_ofs:
+            pool_ofs[s] = len(pool)
+            pool.extend(s.encode("utf-8") + b"\0")
+        return pool_ofs[s]
+
+    admin1_index = {}
+    admin1_ofs = []
+    records = []
+    for c in cities:
+        a = 0xFFFF
+        if c["admin1"]:
+            if c["admin1"] not in admin1_index:
+                admin1_index[c["admin1"]] = len(admin1_ofs)
+                admin1_ofs.append(intern(c["admin1"]))
+            a = admin1_index[c["admin1"]]
+        records.append((intern(c["name"]), a, min(c["population"] // 1000, 0xFFFF), c["lat"], c["lon"]))
+
+    lines = [
+        "/*******************************************************************************",
+        " * Offline city index - generated by scripts/build_city_index.py, do not edit",
+        f" * Cities: {len(records)}",
+        f" * Min population: {min_population}",
+        " ******************************************************************************/",
+        "",
+        '#include "city_index.h"',
+        "",
+        "const char city_fold_latin[CITY_FOLD_LAST - CITY_FOLD_FIRST + 1] = {",
+    ]
+    for i in range(0, len(table), 16):
+        lines.append("    " + ",".join(f"0x{v:02x}" for v in table[i:i + 16]) + ",")
+    lines += ["};", "", "const char city_string_pool[] ="]
+
+    # One literal per string; octal escapes are fixed-width so "\0" is unambiguous
+    strings = sorted(pool_ofs, key=pool_ofs.get)
+    for s in strings:
+        lines.append("    " + c_string(s.encode("utf-8"))[:-1] + '\\0"')
+    if not strings:
+        lines.append('    ""')
+    lines[-1] += ";"
+
+    lines += ["", "const uint32_t city_admin1_ofs[] = {"]
+    for i in range(0, len(admin1_ofs), 12):
+        lines.append("    " + ",".join(str(v) for v in admin1_ofs[i:i + 12]) + ",")
+    if not admin1_ofs:
+        lines.append("    0")
+    lines += ["};", "", "const CityRecord city_records[] = {"]
+    for r in records:
+        lines.append("    {%d, %d, %d, %d, %d}," % r)
+    if not records:
+        lines.append("    {0, CITY_NO_ADMIN1, 0, 0, 0}")
+    lines += ["};", "", f"const uint32_t city_record_count = {len(records)};", ""]
+
+    output_path.write_text("\n".join(lines))
+    return len(table) + len(pool) + 4 * len(admin1_ofs) + 16 * len(records)
+
+
+def warn_empty():
+    print("  WARNING: the offline city index is EMPTY, location search needs the network.")
+    print("  WARNING: GeoNames data was unavailable; run make cities with network access to retry.")
+
+
+def main(project_root: Path):
+    src_dir = project_root / "src"
+    cache_dir = project_root / "scripts" / "geonames_cache"
+    output_path = src_dir / "city_index_data.c"
+    script_path = project_root / "scripts" / "build_city_index.py"
+    min_population = int(os.environ.get("AURA_CITY_MIN_POPULATION", DEFAULT_MIN_POPULATION))
+
+    # Reuse a previous index built by this script with the same population cut
+    if output_path.exists() and output_path.stat().st_mtime > script_path.stat().st_mtime:
+        header = output_path.read_text(encoding="utf-8")[:512]
+        if f" * Min population: {min_population}\n" in header:
+            if " * Cities: 0\n" in header:
+                warn_empty()
+            return
+
+    cache_dir.mkdir(exist_ok=True)
+    print(f"Building offline city index (population >= {min_population})...")
+    cities = load_cities(cache_dir, min_population)
+    if not cities:
+        warn_empty()
+
+    size = generate(cities, build_fold_table(), output_path, min_population)
+    print(f"  Generated {output_path.name}: {len(cities)} cities, {size / 1024:.1f} KB of flash")
+
+
+try:
+    Import("env")  # noqa: F821 - defined when run as a PlatformIO extra script
+    main(Path(env.subst("$PROJECT_DIR")))  # noqa: F821
+except NameError as e:
+    if "Import" not in str(e):
+        raise
+    if __name__ == "__main__":
+        project_root = Path(__file__).resolve().parent.parent
+        if "--force" in sys.argv:
+            (project_root / "src" / "city_index_data.c").unlink(missing_ok=True)
+        main(project_root)
@@ -0,0 +1,358 @@
+#!/usr/bin/env python3
+"""
+Subset the Montserrat Latin fonts to the glyphs the firmware actually draws.
+
+fonts/ holds the full lv_font_conv output for each size. This script keeps
+only the glyphs aura/extract_unicode_chars.py says a size needs and writes
+src/lv_font_montserrat_latin_<size>.c, dropping unused bitmaps, glyph
+descriptions and kerning pairs. ASCII and the LVGL symbols still come from
+the built-in Montserrat fallback of the same size, except for the
+STANDALONE_SIZES: those draw a fixed glyph set, so its ASCII glyphs are
+copied in from LVGL's own lv_font_montserrat_<size>.c and the built-in font
+is left out of lv_conf.h. LVGL is found in LVGL_DIR, by default where
+PlatformIO installs it.
+
+The extended glyphs each language's strings need, and what each pack costs
+in the UI font, are reported along the way.
+
+Characters the UI strings use that no font provides are reported together
+with the lv_font_conv command that regenerates fonts/ with them.
+
+Usable standalone (python scripts/build_fonts.py) or as a PlatformIO
+pre-build script.
+"""
+
+import os
+import re
+import sys
+from pathlib import Path
+
+FONT_NAME = "lv_font_montserrat_latin_{size}"
+
+# Sizes built without a fallback font; must match lv_conf.h
+STANDALONE_SIZES = (42,)
+LVGL_FONT = "src/font/lv_font_montserrat_{size}.c"
+DEFAULT_LVGL_DIR = ".pio/libdeps/esp32dev/lvgl"
+
+# lv_font_conv settings used for everything in fonts/
+FONT_CONV_OPTS = "--bpp 4 --size {size} --no-compress --stride 1 --align 1 --font Montserrat-Light.ttf"
+
+# sizeof(lv_font_fmt_txt_glyph_dsc_t), for the flash estimate
+GLYPH_DSC_BYTES = 8
+
+
+def parse_font(text: str) -> dict:
+    """Pull the glyphs and metrics out of an lv_font_conv LVGL C file."""
+    bitmap_src = re.search(r"glyph_bitmap\[\] = \{(.*?)\n\};", text, re.S).group(1)
+    chunks = re.split(r'/\* U\+([0-9A-F]+) ".*?" \*/', bitmap_src)[1:]
+    bitmaps = {}
+    for cp, body in zip(chunks[::2], chunks[1::2]):
+        bitmaps[int(cp, 16)] = [int(b, 16) for b in re.findall(r"0x[0-9a-f]+", body)]
+
+    dsc_src = re.search(r"glyph_dsc\[\] = \{(.*?)\n\};", text, re.S).group(1)
+    dscs = [dict((k, int(v)) for k, v in re.findall(r"\.(\w+) = (-?\d+)", entry))
+            for entry in re.findall(r"\{([^}]*)\}", dsc_src)][1:]
+
+    # Glyph id -> code point, over every character map
+    codepoints = {}
+    cmaps_src = re.search(r"cmaps\[\] =\s*\{(.*?)\n\};", text, re.S).group(1)
+    for cmap in re.findall(r"\{([^{}]*)\}", cmaps_src):
+        start = int(re.search(r"\.range_start = (\d+)", cmap).group(1))
+        length = int(re.search(r"\.range_length = (\d+)", cmap).group(1))
+        first_id = int(re.search(r"\.glyph_id_start = (\d+)", cmap).group(1))
+        cmap_type = re.search(r"\.type = (\w+)", cmap).group(1)
+        if cmap_type == "LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY":
+            offsets = range(length)
+        elif cmap_type == "LV_FONT_FMT_TXT_CMAP_SPARSE_TINY":
+            list_name = re.search(r"\.unicode_list = (\w+)", cmap).group(1)
+            list_src = re.search(list_name + r"\[\] = \{(.*?)\};", text, re.S).group(1)
+            offsets = [int(v, 16) for v in re.findall(r"0x[0-9a-f]+", list_src)]
+        else:
+            raise ValueError(f"unsupported character map {cmap_type}")
+        for i, offset in enumerate(offsets):
+            codepoints[first_id + i] = start + offset
+
+    glyphs = {}
+    for glyph_id, cp in codepoints.items():
+        glyphs[cp] = {"dsc": dscs[glyph_id - 1], "bitmap": bitmaps.get(cp, [])}
+
+    # Kerning as (left, right, value) code point pairs, from pairs or classes
+    kerning = []
+    kern_bytes = 0
+    if re.search(r"\.kern_classes = 1", text):
+        def table(name, pattern=r"-?\d+"):
+            return [int(v) for v in re.findall(pattern, re.search(
+                name + r"\[\] =\s*\{(.*?)\};", text, re.S).group(1))]
+        left_map = table("kern_left_class_mapping")
+        right_map = table("kern_right_class_mapping")
+        values = table("kern_class_values")
+        right_count = int(re.search(r"\.right_class_cnt\s*= (\d+)", text).group(1))
+        for left_id, left in codepoints.items():
+            for right_id, right in codepoints.items():
+                left_class, right_class = left_map[left_id], right_map[right_id]
+                if left_class and right_class:
+                    value = values[(left_class - 1) * right_count + right_class - 1]
+                    if value:
+                        kerning.append((left, right, value))
+        kern_bytes = len(left_map) + len(right_map) + len(values)
+    elif re.search(r"kern_pair_values\[\]", text):
+        kern_ids = [int(v) for v in re.findall(r"\d+", re.search(
+            r"kern_pair_glyph_ids\[\] =\s*\{(.*?)\};", text, re.S).group(1))]
+        kern_values = [int(v) for v in re.findall(r"-?\d+", re.search(
+            r"kern_pair_values\[\] =\s*\{(.*?)\};", text, re.S).group(1))]
+        for i, value in enumerate(kern_values):
+            kerning.append((codepoints[kern_ids[2 * i]], codepoints[kern_ids[2 * i + 1]], value))
+        kern_bytes = 3 * len(kerning)
+
+    def field(name):
+        return re.search(r"\." + name + r" = ([^,]+),", text).group(1).strip()
+
+    fallback = re.search(r"\.fallback = &(\w+)", text)
+    return {
+        "opts": re.search(r"\* Opts: (.*)", text).group(1),
+        "glyphs": glyphs,
+        "kerning": kerning,
+        "kern_bytes": kern_bytes,
+        "kern_scale": field("kern_scale"),
+        "line_height": field("line_height"),
+        "base_line": field("base_line"),
+        "underline_position": field("underline_position"),
+        "underline_thickness": field("underline_thickness"),
+        "fallback": fallback.group(1) if fallback else None,
+    }
+
+
+def merge_fonts(font: dict, base: dict) -> dict:
+    """font with the glyphs it lacks copied from base, and no fallback.
+
+    Metrics stay those of font, so labels keep their layout. Kerning is kept
+    between glyphs from the same source, rescaled to font's kern_scale."""
+    for source in (font, base):
+        for cp, glyph in source["glyphs"].items():
+            if len(glyph["bitmap"]) != (glyph["dsc"]["box_w"] * glyph["dsc"]["box_h"] * 4 + 7) // 8:
+                raise ValueError(f"U+{cp:04X} is not a packed, uncompressed 4 bpp bitmap")
+    merged = dict(font, glyphs=dict(base["glyphs"]), fallback=None)
+    merged["glyphs"].update(font["glyphs"])
+    scale = int(base["kern_scale"]) / int(font["kern_scale"])
+    from_base = [(left, right, max(-128, min(127, round(value * scale))))
+                 for left, right, value in base["kerning"]
+                 if left not in font["glyphs"] and right not in font["glyphs"]]
+    merged["kerning"] = font["kerning"] + from_base
+    merged["kern_bytes"] = 3 * len(merged["kerning"])
+    return merged
+
+
+def flash_bytes(glyphs: dict, kern_bytes: int) -> int:
+    """Bitmaps, glyph descriptions, code point list and kerning."""
+    bitmap = sum(len(g["bitmap"]) for g in glyphs.values())
+    return bitmap + GLYPH_DSC_BYTES * (len(glyphs) + 1) + 2 * len(glyphs) + kern_bytes
+
+
+def hex_rows(values: list, per_row: int = 8) -> list:
+    rows = []
+    for i in range(0, len(values), per_row):
+        rows.append("    " + ", ".join(f"0x{v:x}" for v in values[i:i + per_row]))
+    return rows
+
+
+def generate(font: dict, keep: set, name: str, source: str) -> tuple:
+    """C source for the subset of font made of the code points in keep, and its flash size."""
+    codepoints = sorted(cp for cp in font["glyphs"] if cp in keep)
+    glyph_ids = {cp: i + 1 for i, cp in enumerate(codepoints)}
+    kerning = [k for k in font["kerning"] if k[0] in glyph_ids and k[1] in glyph_ids]
+    guard = name.upper()
+
+    lines = [
+        "/*******************************************************************************",
+        f" * Generated by scripts/build_fonts.py from {source}, do not edit",
+        f" * Opts: {font['opts']}",
+        " * Glyphs: " + "".join(chr(cp) for cp in codepoints),
+        " ******************************************************************************/",
+        "",
+        '#include "lvgl.h"',
+        "",
+        f"#ifndef {guard}",
+        f"#define {guard} 1",
+        "#endif",
+        "",
+        f"#if {guard}",
+        "",
+        "static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {",
+    ]
+    bitmap_index = {}
+    offset = 0
+    rows = []
+    for cp in codepoints:
+        bitmap = font["glyphs"][cp]["bitmap"]
+        bitmap_index[cp] = offset
+        offset += len(bitmap)
+        rows.append(f'    /* U+{cp:04X} "{chr(cp)}" */')
+        body = hex_rows(bitmap)
+        rows += [row + "," for row in body]
+    if not offset:
+        rows.append("    0x0,")
+    rows[-1] = rows[-1].rstrip(",")
+    lines += rows + ["};", ""]
+
+    lines.append("static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {")
+    entries = ["    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */"]
+    for cp in codepoints:
+        d = font["glyphs"][cp]["dsc"]
+        entries.append(f"    {{.bitmap_index = {bitmap_index[cp]}, .adv_w = {d['adv_w']}, .box_w = {d['box_w']}, "
+                       f".box_h = {d['box_h']}, .ofs_x = {d['ofs_x']}, .ofs_y = {d['ofs_y']}}}")
+    lines += [",\n".join(entries), "};", ""]
+
+    if codepoints:
+        start = codepoints[0]
+        lines.append("static const uint16_t unicode_list_0[] = {")
+        lines += [",\n".join(hex_rows([cp - start for cp in codepoints])), "};", ""]
+        lines += [
+            "static const lv_font_fmt_txt_cmap_t cmaps[] = {",
+            "    {",
+            f"        .range_start = {start}, .range_length = {codepoints[-1] - start + 1}, .glyph_id_start = 1,",
+            f"        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = {len(codepoints)},",
+            "        .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY",
+            "    }",
+            "};",
+            "",
+        ]
+
+    if kerning:
+        ids = ", ".join(f"{glyph_ids[left]}, {glyph_ids[right]}" for left, right, _ in kerning)
+        values = ", ".join(str(value) for _, _, value in kerning)
+        lines += [
+            f"static const uint8_t kern_pair_glyph_ids[] = {{{ids}}};",
+            f"static const int8_t kern_pair_values[] = {{{values}}};",
+            "",
+            "static const lv_font_fmt_txt_kern_pair_t kern_pairs = {",
+            "    .glyph_ids = kern_pair_glyph_ids,",
+            "    .values = kern_pair_values,",
+            f"    .pair_cnt = {len(kerning)},",
+            "    .glyph_ids_size = 0",
+            "};",
+            "",
+        ]
+
+    lines += [
+        "static const lv_font_fmt_txt_dsc_t font_dsc = {",
+        "    .glyph_bitmap = glyph_bitmap,",
+        "    .glyph_dsc = glyph_dsc,",
+        f"    .cmaps = {'cmaps' if codepoints else 'NULL'},",
+        f"    .kern_dsc = {'&kern_pairs' if kerning else 'NULL'},",
+        f"    .kern_scale = {font['kern_scale']},",
+        f"    .cmap_num = {1 if codepoints else 0},",
+        "    .bpp = 4,",
+        "    .kern_classes = 0,",
+        "    .bitmap_format = 0,",
+        "};",
+        "",
+    ]
+    if font["fallback"]:
+        lines += [f"extern const lv_font_t {font['fallback']};", ""]
+    lines += [
+        f"const lv_font_t {name} = {{",
+        "    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,",
+        "    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,",
+        f"    .line_height = {font['line_height']},",
+        f"    .base_line = {font['base_line']},",
+        "    .subpx = LV_FONT_SUBPX_NONE,",
+        f"    .underline_position = {font['underline_position']},",
+        f"    .underline_thickness = {font['underline_thickness']},",
+        "    .dsc = &font_dsc,",
+        f"    .fallback = {'&' + font['fallback'] if font['fallback'] else 'NULL'},",
+        "    .user_data = NULL,",
+        "};",
+        "",
+        f"#endif /* {guard} */",
+        "",
+    ]
+    return "\n".join(lines), flash_bytes({cp: font["glyphs"][cp] for cp in codepoints}, 3 * len(kerning))
+
+
+def print_language_packs(project_root: Path, size: int, font: dict):
+    """Extended glyphs each language's strings need at size, and their flash cost."""
+    from extract_unicode_chars import language_chars  # noqa: E402
+
+    print(f"  Language packs at {size} px (extended glyphs each language needs):")
+    for language, chars in language_chars(project_root).items():
+        extended = sorted((c for c in chars if ord(c) > 0x7E), key=ord)
+        have = {ord(c): font["glyphs"][ord(c)] for c in extended if ord(c) in font["glyphs"]}
+        missing = "".join(c for c in extended if ord(c) not in have)
+        cost = flash_bytes(have, 0) - GLYPH_DSC_BYTES if have else 0
+        print(f"    {language}: {''.join(extended) or '(none)'}, {cost} bytes"
+              + (f", missing {missing}" if missing else ""))
+
+
+def main(project_root: Path, lvgl_dir: Path):
+    sys.path.insert(0, str(project_root / "aura"))
+    from extract_unicode_chars import FONT_CONTENT, glyph_sets, ui_chars  # noqa: E402
+
+    fonts_dir = project_root / "fonts"
+    src_dir = project_root / "src"
+    script_path = project_root / "scripts" / "build_fonts.py"
+    inputs = [script_path, project_root / "aura" / "extract_unicode_chars.py",
+              project_root / "include" / "translations.h", project_root / "src" / "main.cpp"]
+    newest_input = max(p.stat().st_mtime for p in inputs)
+
+    sets = glyph_sets(project_root)
+    outputs = {size: src_dir / (FONT_NAME.format(size=size) + ".c") for size in sets}
+    sources = {size: [fonts_dir / out.name] for size, out in outputs.items()}
+    for size in STANDALONE_SIZES:
+        builtin = lvgl_dir / LVGL_FONT.format(size=size)
+        if not builtin.exists():
+            sys.exit(f"build_fonts.py: {builtin} not found. The {size} px font copies its ASCII "
+                     "glyphs from LVGL's; build the firmware once or set LVGL_DIR.")
+        sources[size].append(builtin)
+
+    # Skip the work when every subset is newer than everything it depends on
+    if all(out.exists() and out.stat().st_mtime > max([newest_input] + [p.stat().st_mtime for p in sources[size]])
+           for size, out in outputs.items()):
+        return
+
+    print("Subsetting Montserrat Latin fonts...")
+    available = set(range(0x20, 0x7F))
+    for size, chars in sorted(sets.items()):
+        name = FONT_NAME.format(size=size)
+        font = parse_font(sources[size][0].read_text(encoding="utf-8"))
+        keep = set(font["glyphs"]) if chars is None else {ord(c) for c in chars}
+        available |= set(font["glyphs"])
+        size_before = flash_bytes(font["glyphs"], font["kern_bytes"])
+        source = f"fonts/{sources[size][0].name}"
+
+        if size in STANDALONE_SIZES:
+            builtin = parse_font(sources[size][1].read_text(encoding="utf-8"))
+            size_before += flash_bytes(builtin["glyphs"], builtin["kern_bytes"])
+            font = merge_fonts(font, builtin)
+            source += f" and LVGL's {sources[size][1].name}"
+            absent = "".join(chr(cp) for cp in sorted(keep - set(font["glyphs"])))
+            if absent:
+                sys.exit(f"build_fonts.py: neither source has glyphs for {absent} at {size} px")
+
+        code, size_after = generate(font, keep, name, source)
+        outputs[size].write_text(code, encoding="utf-8")
+        print(f"  {name}: {len(font['glyphs'])} -> {len(keep & set(font['glyphs']))} glyphs, "
+              f"{size_before} -> {size_after} bytes ({size_before - size_after} reclaimed)"
+              + (", no fallback" if size in STANDALONE_SIZES else ""))
+        if FONT_CONTENT[size] == "ui":
+            print_language_packs(project_root, size, font)
+
+    missing = "".join(sorted((c for c in ui_chars(project_root) if ord(c) not in available), key=ord))
+    if missing:
+        symbols = "".join(sorted({chr(cp) for cp in available if cp > 0x7E} | set(missing), key=ord))
+        print(f"  Warning: no font has glyphs for {missing}; regenerate fonts/ with")
+        print(f"    npx lv_font_conv {FONT_CONV_OPTS.format(size='<size>')} "
+              f"--symbols {symbols} --format lvgl -o fonts/{FONT_NAME.format(size='<size>')}.c")
+
+
+try:
+    Import("env")  # noqa: F821 - defined when run as a PlatformIO extra script
+    main(Path(env.subst("$PROJECT_DIR")), Path(env.subst("$PROJECT_LIBDEPS_DIR/$PIOENV/lvgl")))  # noqa: F821
+except NameError as e:
+    if "Import" not in str(e):
+        raise
+    if __name__ == "__main__":
+        project_root = Path(__file__).resolve().parent.parent
+        if "--force" in sys.argv:
+            for path in (project_root / "src").glob(FONT_NAME.format(size="*") + ".c"):
+                path.unlink()
+        main(project_root, Path(os.environ.get("LVGL_DIR", project_root / DEFAULT_LVGL_DIR)))
@@ -0,0 +1,107 @@
+// Host benchmark of the offline city index (src/city_index.cpp) over the
+// generated src/city_index_data.c: its size in flash, and the latency of
+// the prefix searches the location dialog makes as a name is typed, one
+// per keystroke.
+//
+//     make city-bench
+//
+// The index is whatever build_city_index.py last generated; without the
+// GeoNames data it is empty and there is nothing to measure.
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "city_index.h"
+
+// As in src/main.cpp
+#define MAX_GEO_RESULTS 15
+
+#define RUNS 5
+#define ROUNDS 2000
+
+static const char *const typed[] = {
+  "London", "Los Angeles", "San Francisco", "São Paulo", "Zürich", "New York",
+  "Ōsaka", "Berlin", "Mexico City", "Saint Petersburg", "Kraków", "Xyzzy",
+};
+
+static double now_us() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+// The string pool has no size symbol; it ends after its last string
+static size_t string_pool_size(uint32_t admin1_count) {
+  size_t end = 0;
+  for (uint32_t i = 0; i < city_record_count; i++) {
+    size_t ofs = city_records[i].name_ofs;
+    if (ofs + strlen(city_string_pool + ofs) + 1 > end) end = ofs + strlen(city_string_pool + ofs) + 1;
+  }
+  for (uint32_t i = 0; i < admin1_count; i++) {
+    size_t ofs = city_admin1_ofs[i];
+    if (ofs + strlen(city_string_pool + ofs) + 1 > end) end = ofs + strlen(city_string_pool + ofs) + 1;
+  }
+  return end;
+}
+
+int main() {
+  if (city_record_count == 0) {
+    printf("The offline city index is empty; run make cities with network access\n");
+    return 1;
+  }
+
+  uint32_t admin1_count = 0;
+  for (uint32_t i = 0; i < city_record_count; i++) {
+    if (city_records[i].admin1 != CITY_NO_ADMIN1 && city_records[i].admin1 + 1u > admin1_count) {
+      admin1_count = city_records[i].admin1 + 1;
+    }
+  }
+  size_t records = city_record_count * sizeof(CityRecord);
+  size_t pool = string_pool_size(admin1_count);
+  size_t admin1 = admin1_count * sizeof(uint32_t);
+  size_t fold = sizeof(city_fold_latin);
+  printf("Index: %u cities, %zu B records + %zu B strings + %zu B regions + %zu B fold table = %.1f KB\n",
+         city_record_count, records, pool, admin1, fold, (records + pool + admin1 + fold) / 1024.0);
+
+  // Every prefix of every name, as typed one character at a time
+  char prefixes[128][CITY_KEY_MAX + 1];
+  int prefix_count = 0;
+  for (const char *name : typed) {
+    size_t len = strlen(name);
+    for (size_t end = 1; end <= len && prefix_count < 128; end++) {
+      if (((unsigned char)name[end] & 0xC0) == 0x80) continue;  // Mid UTF-8 sequence
+      memcpy(prefixes[prefix_count], name, end);
+      prefixes[prefix_count++][end] = '\0';
+    }
+  }
+
+  const CityRecord *found[MAX_GEO_RESULTS];
+  double worst = 0;
+  const char *worst_prefix = "";
+  size_t worst_matches = 0;
+  double total = 0;
+  for (int p = 0; p < prefix_count; p++) {
+    double best = 1e30;
+    size_t count = 0;
+    for (int run = 0; run < RUNS; run++) {
+      double start = now_us();
+      for (int i = 0; i < ROUNDS; i++) count = city_index_search(prefixes[p], found, MAX_GEO_RESULTS);
+      double us = (now_us() - start) / ROUNDS;
+      if (us < best) best = us;
+    }
+    total += best;
+    if (best > worst) {
+      worst = best;
+      worst_prefix = prefixes[p];
+      worst_matches = count;
+    }
+  }
+  printf("Search: %d prefixes, mean %.2f us, worst %.2f us (\"%s\", %zu shown)\n",
+         prefix_count, total / prefix_count, worst, worst_prefix, worst_matches);
+
+  size_t count = city_index_search("San", found, MAX_GEO_RESULTS);
+  printf("\"San\":");
+  for (size_t i = 0; i < count && i < 5; i++) printf(" %s (%uk)", city_name(found[i]), found[i]->population_k);
+  printf("\n");
+  return 0;
+}
@@ -0,0 +1,420 @@
+#!/usr/bin/env python3
+"""
+Local stand-in for the Open-Meteo forecast and geocoding APIs and TfL
+arrivals, with injectable network faults, to see how the UI copes with a
+slow or flaky link.
+
+Build the firmware with CONFIG_API_STUB pointing at this machine, e.g.
+#define CONFIG_API_STUB "http://192.168.1.20:8080" in config.h. Then either
+
+  python scripts/fault_server.py serve --latency 3 --bandwidth 2000
+
+holds one fault while you use the device, or
+
+  python scripts/fault_server.py run --device aura.local
+
+steps through every fault profile and reports for each, from the device's
+/metrics: the longest the UI went without running (aura_ui_gap), the
+slowest touch response, the slowest fetch and the fetches that failed.
+Each profile starts with a POST /refresh, which only stub builds serve.
+Tap the screen during each profile to get touch figures; search for a
+place to exercise the geocoder.
+
+Responses are replayed from scripts/fixtures/<kind>/, matched by URL: the
+forecast by location count and units, a search by its query and arrivals
+by stop ID. Without an exact match any recording of the same kind is used
+(for a forecast, only one in the same units), and without one of those a
+small built-in sample. The fixtures committed here are hand-built in each
+API's schema rather than recorded: a 3-location forecast in both units, a
+15-result search for "san" and Oxford Circus (940GZZLUOXC) arrivals. To record real ones,
+either proxy the device's own requests to the real APIs:
+
+  python scripts/fault_server.py record
+
+or fetch chosen URLs directly, e.g. a large station or a 15-result search:
+
+  python scripts/fault_server.py capture /StopPoint/940GZZLUOXC/Arrivals "/v1/search?name=San&count=15"
+
+Each recording is the body (<key>.json) and the status line and headers
+(<key>.headers), so a replay is byte for byte what the API sent.
+"""
+
+import argparse
+import json
+import random
+import re
+import socket
+import struct
+import threading
+import time
+import urllib.error
+import urllib.request
+from dataclasses import dataclass, replace
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from pathlib import Path
+from urllib.parse import parse_qs, urlsplit
+
+FIXTURES_DIR = Path(__file__).resolve().parent / "fixtures"
+
+# Where record and capture send each kind of request
+UPSTREAMS = {
+    "forecast": "http://api.open-meteo.com",
+    "search": "https://geocoding-api.open-meteo.com",
+    "arrivals": "https://api.tfl.gov.uk",
+}
+
+# Describe the original connection rather than the payload, so not replayed
+HOP_HEADERS = {"connection", "content-length", "content-encoding", "keep-alive", "transfer-encoding"}
+
+
+@dataclass
+class Response:
+    status: int
+    headers: list   # (name, value) pairs
+    body: bytes
+
+
+@dataclass
+class Fault:
+    latency: float = 0.0      # Seconds before the status line
+    bandwidth: int = 0        # Body bytes per second, 0 for unlimited
+    truncate: float = 1.0     # Fraction of the body sent before closing
+    hang: float = 0.0         # Seconds to hold the socket open after a truncated body
+    reset: float = 0.0        # Chance of a TCP reset instead of a response
+    error_burst: int = 0      # The first error_burst of every error_every requests get a 503
+    error_every: int = 4
+
+
+# Steps of the run command, mildest first
+PROFILES = {
+    "baseline": Fault(),
+    "latency_2s": Fault(latency=2),
+    "latency_8s": Fault(latency=8),
+    "slow_link": Fault(bandwidth=1000),
+    "truncated": Fault(truncate=0.5),
+    "stalled_body": Fault(truncate=0.5, hang=15),
+    "resets": Fault(reset=1.0),
+    "errors_5xx": Fault(error_burst=3, error_every=4),
+}
+
+
+def forecast_location(index: int, now: int, fahrenheit: bool = False) -> dict:
+    """One location of a forecast response, with timeformat=unixtime."""
+    midnight = now - now % 86400
+    hour = now - now % 3600
+    temp = (lambda c: round(c * 9 / 5 + 32, 1)) if fahrenheit else (lambda c: c)
+    rain = (lambda mm: round(mm / 25.4, 3)) if fahrenheit else (lambda mm: mm)
+    return {
+        "latitude": 51.5, "longitude": -0.12, "utc_offset_seconds": 0, "timezone": "Europe/London",
+        "current": {"time": now, "temperature_2m": temp(12.3 + index), "apparent_temperature": temp(10.1),
+                    "is_day": 1, "weather_code": 3},
+        "daily": {
+            "time": [midnight + i * 86400 for i in range(7)],
+            "temperature_2m_min": [temp(5.0 + i) for i in range(7)],
+            "temperature_2m_max": [temp(14.0 + i) for i in range(7)],
+            "weather_code": [3, 61, 2, 0, 45, 80, 1],
+            "sunrise": [midnight + i * 86400 + 6 * 3600 for i in range(7)],
+            "sunset": [midnight + i * 86400 + 19 * 3600 for i in range(7)],
+        },
+        "hourly": {
+            "time": [hour + i * 3600 for i in range(7)],
+            "temperature_2m": [temp(12.0 + i * 0.5) for i in range(7)],
+            "precipitation_probability": [10, 20, 40, 60, 30, 10, 0],
+            "precipitation": [rain(mm) for mm in (0.0, 0.1, 0.4, 1.2, 0.3, 0.0, 0.0)],
+            "is_day": [1] * 7,
+            "weather_code": [3, 3, 61, 63, 61, 3, 2],
+        },
+    }
+
+
+def builtin_payload(kind: str) -> object:
+    if kind == "search":
+        return {"results": [{"name": "London", "admin1": "England", "latitude": 51.50853, "longitude": -0.12574}]}
+    lines = ["73", "38", "Victoria"]
+    return [{"lineName": lines[i % 3], "destinationName": "Oxford Circus", "towards": "Brixton",
+             "timeToStation": 60 + i * 97} for i in range(8)]
+
+
+def json_response(payload: object) -> Response:
+    return Response(200, [("Content-Type", "application/json")], json.dumps(payload, separators=(",", ":")).encode())
+
+
+def route(path: str):
+    """(kind, fixture key) for a request path, or None if it is not an API the device uses."""
+    url = urlsplit(path)
+    query = parse_qs(url.query)
+    if url.path == "/v1/forecast":
+        count = len(query.get("latitude", ["0"])[0].split(","))
+        units = "-fahrenheit" if query.get("temperature_unit") == ["fahrenheit"] else ""
+        return "forecast", f"{count}-locations{units}"
+    if url.path == "/v1/search":
+        return "search", query.get("name", [""])[0].lower()
+    m = re.fullmatch(r"/StopPoint/([^/]+)/Arrivals", url.path)
+    if m:
+        return "arrivals", m.group(1)
+    return None
+
+
+def fixture_path(kind: str, key: str) -> Path:
+    name = re.sub(r"[^\w.-]+", "_", key) or "_"
+    return FIXTURES_DIR / kind / f"{name}.json"
+
+
+def read_fixture(path: Path) -> Response:
+    lines = path.with_name(path.stem + ".headers").read_text().splitlines()
+    status = int(lines[0].split()[1])
+    headers = [tuple(part.strip() for part in line.split(":", 1)) for line in lines[1:] if ":" in line]
+    return Response(status, headers, path.read_bytes())
+
+
+def save_fixture(kind: str, key: str, response: Response) -> Path:
+    path = fixture_path(kind, key)
+    path.parent.mkdir(parents=True, exist_ok=True)
+    path.write_bytes(response.body)
+    headers = "".join(f"{name}: {value}\n" for name, value in response.headers)
+    path.with_name(path.stem + ".headers").write_text(f"HTTP {response.status}\n{headers}")
+    return path
+
+
+def forecast_response(count: int, units: str, recorded: list) -> Response:
+    """count locations, taken in turn from a recording in the same units with a different count if there is one."""
+    recorded = [path for path in recorded if path.stem.endswith("-fahrenheit") == (units == "fahrenheit")]
+    if recorded:
+        payload = json.loads(recorded[0].read_bytes())
+        locations = payload if isinstance(payload, list) else [payload]
+    else:
+        now = int(time.time())
+        locations = [forecast_location(i, now, units == "fahrenheit") for i in range(count)]
+    locations = [locations[i % len(locations)] for i in range(count)]
+    return json_response(locations[0] if count == 1 else locations)
+
+
+def load_fixture(kind: str, key: str) -> Response:
+    """The recording for key, else any recording of the same kind, else a built-in sample."""
+    exact = fixture_path(kind, key)
+    if exact.exists():
+        return read_fixture(exact)
+    recorded = sorted((FIXTURES_DIR / kind).glob("*.json"))
+    if kind == "forecast":
+        count, _, units = key.partition("-locations")
+        return forecast_response(int(count), units.lstrip("-"), recorded)
+    if recorded:
+        return read_fixture(recorded[0])
+    return json_response(builtin_payload(kind))
+
+
+def fetch_upstream(kind: str, path: str) -> Response:
+    request = urllib.request.Request(UPSTREAMS[kind] + path, headers={"User-Agent": "ESP32HTTPClient"})
+    try:
+        with urllib.request.urlopen(request, timeout=30) as response:
+            return Response(response.status, list(response.headers.items()), response.read())
+    except urllib.error.HTTPError as e:
+        return Response(e.code, list(e.headers.items()), e.read())
+
+
+def record(path: str) -> Response:
+    """Fetch path from the real API and keep it as a fixture if it succeeded."""
+    kind, key = route(path)
+    response = fetch_upstream(kind, path)
+    if response.status == 200:
+        saved = save_fixture(kind, key, response)
+        print(f"  Recorded {len(response.body)} bytes to {saved.relative_to(FIXTURES_DIR.parent)}")
+    else:
+        print(f"  {UPSTREAMS[kind]}{path} returned {response.status}, not recorded")
+    return response
+
+
+class FaultServer(ThreadingHTTPServer):
+    daemon_threads = True
+
+    def __init__(self, address, fault: Fault, recording: bool = False):
+        super().__init__(address, StubHandler)
+        self.fault = fault
+        self.recording = recording  # Pass requests through to the real APIs
+        self.requests = 0
+        self.lock = threading.Lock()
+
+    def next_request(self) -> int:
+        with self.lock:
+            self.requests += 1
+            return self.requests - 1
+
+
+class StubHandler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.0"
+
+    def log_message(self, fmt, *args):
+        print(f"  {self.address_string()} {fmt % args}")
+
+    def do_GET(self):
+        fault = self.server.fault
+        n = self.server.next_request()
+        target = route(self.path)
+        if not target:
+            self.send_error(404)
+            return
+        response = record(self.path) if self.server.recording else load_fixture(*target)
+
+        if fault.latency:
+            time.sleep(fault.latency)
+        if random.random() < fault.reset:
+            self.reset()
+            return
+        if fault.error_burst and n % fault.error_every < fault.error_burst:
+            self.send_error(503)
+            return
+
+        body = response.body
+        self.send_response(response.status)
+        for name, value in response.headers:
+            if name.lower() not in HOP_HEADERS:
+                self.send_header(name, value)
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+
+        sent = body[:int(len(body) * fault.truncate)]
+        chunk = max(1, fault.bandwidth // 10) if fault.bandwidth else len(sent) or 1
+        try:
+            for i in range(0, len(sent), chunk):
+                self.wfile.write(sent[i:i + chunk])
+                self.wfile.flush()
+                if fault.bandwidth:
+                    time.sleep(chunk / fault.bandwidth)
+            if len(sent) < len(body) and fault.hang:
+                time.sleep(fault.hang)
+        except (BrokenPipeError, ConnectionResetError):
+            pass
+
+    def reset(self):
+        """Close with RST rather than FIN."""
+        self.connection.setsockopt(socket.SOL_SOCKET, socket.SO_LINGER, struct.pack("ii", 1, 0))
+        self.connection.close()
+        self.close_connection = True
+
+
+def start_server(port: int, fault: Fault) -> FaultServer:
+    server = FaultServer(("", port), fault)
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+    return server
+
+
+def scrape(device: str) -> dict:
+    """Device metrics as {(name, labels): value}. Also restarts its _max gauges."""
+    with urllib.request.urlopen(f"http://{device}/metrics", timeout=10) as response:
+        text = response.read().decode()
+    metrics = {}
+    for line in text.splitlines():
+        m = re.fullmatch(r"(\w+)(\{[^}]*\})? (\S+)", line)
+        if m:
+            metrics[(m.group(1), m.group(2) or "")] = float(m.group(3))
+    return metrics
+
+
+def request_refresh(device: str):
+    request = urllib.request.Request(f"http://{device}/refresh", method="POST")
+    urllib.request.urlopen(request, timeout=10).close()
+
+
+def ms(value) -> str:
+    return "-" if value is None else f"{value * 1000:.0f}"
+
+
+def run_profile(device: str, server: FaultServer, name: str, seconds: int) -> list:
+    server.fault = PROFILES[name]
+    before = scrape(device)  # Also restarts the max gauges
+    request_refresh(device)
+    time.sleep(seconds)
+    after = scrape(device)
+
+    def delta(key):
+        return after.get(key, 0) - before.get(key, 0)
+
+    touches = delta(("aura_touch_latency_seconds_count", ""))
+    fetch_max = max((v for (k, labels), v in after.items() if k == "aura_fetch_duration_max_seconds"), default=None)
+    errors = sum(after[k] - before.get(k, 0) for k in after if k[0] == "aura_fetch_errors_total")
+    return [name, ms(after.get(("aura_ui_gap_max_seconds", ""))),
+            ms(after.get(("aura_touch_latency_max_seconds", ""))) if touches else "-",
+            ms(fetch_max), f"{errors:.0f}"]
+
+
+def run(args):
+    server = start_server(args.port, PROFILES["baseline"])
+    names = args.profile or list(PROFILES)
+    print(f"Stub API on port {args.port}, {args.seconds} s per profile. Tap the screen now and then.")
+
+    rows = []
+    for name in names:
+        print(f"{name}...")
+        rows.append(run_profile(args.device, server, name, args.seconds))
+    server.fault = PROFILES["baseline"]
+
+    header = ["profile", "UI gap ms", "touch ms", "fetch ms", "failed"]
+    print()
+    print(f"{header[0]:<14}" + "".join(f"{h:>11}" for h in header[1:]))
+    for row in rows:
+        print(f"{row[0]:<14}" + "".join(f"{c:>11}" for c in row[1:]))
+
+
+def serve(args):
+    fault = replace(PROFILES[args.profile]) if args.profile else Fault()
+    for field in ("latency", "bandwidth", "truncate", "hang", "reset", "error_burst", "error_every"):
+        value = getattr(args, field)
+        if value is not None:
+            setattr(fault, field, value)
+    server = FaultServer(("", args.port), fault)
+    print(f"Stub API on port {args.port} with {fault}")
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+def record_server(args):
+    server = FaultServer(("", args.port), Fault(), recording=True)
+    print(f"Recording proxy on port {args.port}, fixtures in {FIXTURES_DIR}")
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+def capture(args):
+    for path in args.path:
+        if not route(path):
+            raise SystemExit(f"{path} is not a forecast, search or StopPoint arrivals URL")
+        record(path)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    serve_parser = commands.add_parser("serve", help="serve with one fault until interrupted")
+    serve_parser.add_argument("--port", type=int, default=8080)
+    serve_parser.add_argument("--profile", choices=PROFILES, help="start from a named profile")
+    serve_parser.add_argument("--latency", type=float)
+    serve_parser.add_argument("--bandwidth", type=int)
+    serve_parser.add_argument("--truncate", type=float)
+    serve_parser.add_argument("--hang", type=float)
+    serve_parser.add_argument("--reset", type=float)
+    serve_parser.add_argument("--error-burst", type=int)
+    serve_parser.add_argument("--error-every", type=int)
+
+    run_parser = commands.add_parser("run", help="step through the fault profiles and report")
+    run_parser.add_argument("--device", default="aura.local")
+    run_parser.add_argument("--port", type=int, default=8080)
+    run_parser.add_argument("--seconds", type=int, default=30, help="time spent in each profile")
+    run_parser.add_argument("--profile", action="append", choices=PROFILES, help="only these profiles")
+
+    record_parser = commands.add_parser("record", help="proxy to the real APIs and keep every response")
+    record_parser.add_argument("--port", type=int, default=8080)
+
+    capture_parser = commands.add_parser("capture", help="fetch API paths directly and keep the responses")
+    capture_parser.add_argument("path", nargs="+", help="path and query, as the device would request it")
+
+    args = parser.parse_args()
+    {"serve": serve, "run": run, "record": record_server, "capture": capture}[args.command](args)
+
+
+if __name__ == "__main__":
+    main()
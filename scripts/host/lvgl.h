@@ -0,0 +1,37 @@
+// The part of LVGL 9.2's lvgl.h that src/assets.cpp uses, for host checks
+// when LVGL itself is not on disk (make assets-test). The layout matches
+// lv_image_dsc.h; with LVGL fetched the real header is used instead.
+
+#ifndef HOST_LVGL_H
+#define HOST_LVGL_H
+
+#include <stdint.h>
+
+#define LV_IMAGE_HEADER_MAGIC (0x19)
+
+typedef enum {
+  LV_COLOR_FORMAT_RGB565 = 0x12,
+  LV_COLOR_FORMAT_RGB565A8 = 0x14,
+} lv_color_format_t;
+
+typedef struct {
+  uint32_t magic : 8;
+  uint32_t cf : 8;
+  uint32_t flags : 16;
+
+  uint32_t w : 16;
+  uint32_t h : 16;
+  uint32_t stride : 16;
+  uint32_t reserved_2 : 16;
+} lv_image_header_t;
+
+typedef struct {
+  lv_image_header_t header;
+  uint32_t data_size;
+  const uint8_t *data;
+  const void *reserved;
+} lv_image_dsc_t;
+
+typedef lv_image_dsc_t lv_img_dsc_t;
+
+#endif // HOST_LVGL_H
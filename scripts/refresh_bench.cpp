@@ -0,0 +1,161 @@
+// Host benchmark of the CPU work in one weather refresh, in both units: the
+// recorded three-location forecast streamed through OpenMeteoParser in
+// 256-byte chunks, then every label of the current, daily and hourly panels
+// built with the integer formatters in src/open_meteo.cpp. The labels are
+// also built the way they were before fixed-point parsing, with float
+// printf, for comparison.
+//
+//     make refresh-bench
+//
+// Network and LVGL time are not included; this is the part a faster parser
+// or formatter can change.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "open_meteo.h"
+
+// As in src/main.cpp
+#define MAX_LOCATIONS 3
+#define STREAM_CHUNK 256
+
+#define RUNS 5
+#define ROUNDS 2000
+
+struct Fixture {
+  const char *path;
+  char *body;
+  size_t len;
+};
+
+static Fixture fixtures[] = {
+  {"scripts/fixtures/forecast/3-locations.json", nullptr, 0},
+  {"scripts/fixtures/forecast/3-locations-fahrenheit.json", nullptr, 0},
+};
+
+static WeatherModel models[MAX_LOCATIONS];
+static char labels[2 + 2 * FORECAST_DAYS + 3 * FORECAST_HOURS][16];
+static unsigned checksum = 0;
+
+static double now_us() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static int parse(const Fixture &f) {
+  OpenMeteoParser parser(models, MAX_LOCATIONS);
+  for (size_t at = 0; at < f.len && !parser.complete(); at += STREAM_CHUNK) {
+    parser.feed(f.body + at, f.len - at < STREAM_CHUNK ? f.len - at : STREAM_CHUNK);
+  }
+  return parser.parsed();
+}
+
+// format_temperature() in src/main.cpp
+static void temperature(char *buf, size_t size, int16_t tenths, char unit) {
+  size_t len = format_int(buf, size, fixed_round(tenths, 10));
+  if (len + 3 < size) {
+    memcpy(buf + len, "°", 2);
+    buf[len + 2] = unit;
+    buf[len + 3] = '\0';
+  }
+}
+
+static void fixed_labels(const WeatherModel &m) {
+  char unit = m.fahrenheit ? 'F' : 'C';
+  int n = 0;
+  temperature(labels[n++], sizeof(labels[0]), m.t_now, unit);
+  temperature(labels[n++], sizeof(labels[0]), m.t_feels, unit);
+  for (int i = 0; i < FORECAST_DAYS; i++) {
+    temperature(labels[n++], sizeof(labels[0]), m.daily[i].t_max, unit);
+    temperature(labels[n++], sizeof(labels[0]), m.daily[i].t_min, unit);
+  }
+  for (int i = 0; i < FORECAST_HOURS; i++) {
+    const HourlyForecast &h = m.hourly[i];
+    format_int(labels[n++], sizeof(labels[0]), local_hour(h.time, m.utc_offset_seconds));
+    if (format_precip(labels[n], sizeof(labels[0]), h.precip, m.fahrenheit) == 0 && h.precip_prob > 0) {
+      size_t len = format_int(labels[n], sizeof(labels[0]), h.precip_prob);
+      labels[n][len] = '%';
+      labels[n][len + 1] = '\0';
+    }
+    n++;
+    temperature(labels[n++], sizeof(labels[0]), h.temp, unit);
+  }
+  for (int i = 0; i < n; i++) checksum += (unsigned char)labels[i][0];
+}
+
+// As the labels were built from float fields with lv_label_set_text_fmt()
+static void printf_labels(const WeatherModel &m) {
+  char unit = m.fahrenheit ? 'F' : 'C';
+  const char *precip_unit = m.fahrenheit ? "in" : "mm";
+  int n = 0;
+  snprintf(labels[n++], sizeof(labels[0]), "%.0f°%c", m.t_now / 10.0f, unit);
+  snprintf(labels[n++], sizeof(labels[0]), "%.0f°%c", m.t_feels / 10.0f, unit);
+  for (int i = 0; i < FORECAST_DAYS; i++) {
+    snprintf(labels[n++], sizeof(labels[0]), "%.0f°%c", m.daily[i].t_max / 10.0f, unit);
+    snprintf(labels[n++], sizeof(labels[0]), "%.0f°%c", m.daily[i].t_min / 10.0f, unit);
+  }
+  for (int i = 0; i < FORECAST_HOURS; i++) {
+    const HourlyForecast &h = m.hourly[i];
+    float precip = h.precip / 100.0f;
+    snprintf(labels[n++], sizeof(labels[0]), "%d", local_hour(h.time, m.utc_offset_seconds));
+    if (precip >= 0.1f) {
+      snprintf(labels[n++], sizeof(labels[0]), "%.1f%s", precip, precip_unit);
+    } else if (h.precip_prob > 0) {
+      snprintf(labels[n++], sizeof(labels[0]), "%d%%", h.precip_prob);
+    } else {
+      labels[n++][0] = '\0';
+    }
+    snprintf(labels[n++], sizeof(labels[0]), "%.0f°%c", h.temp / 10.0f, unit);
+  }
+  for (int i = 0; i < n; i++) checksum += (unsigned char)labels[i][0];
+}
+
+template <typename Work>
+static double best_us(Work work) {
+  double best = 1e30;
+  for (int run = 0; run < RUNS; run++) {
+    double start = now_us();
+    for (int i = 0; i < ROUNDS; i++) work();
+    double us = (now_us() - start) / ROUNDS;
+    if (us < best) best = us;
+  }
+  return best;
+}
+
+int main() {
+  for (Fixture &f : fixtures) {
+    FILE *file = fopen(f.path, "rb");
+    if (!file) {
+      printf("Cannot open %s\n", f.path);
+      return 1;
+    }
+    fseek(file, 0, SEEK_END);
+    f.len = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    f.body = (char *)malloc(f.len);
+    f.len = fread(f.body, 1, f.len, file);
+    fclose(file);
+    if (parse(f) != MAX_LOCATIONS) {
+      printf("%s did not parse into %d locations\n", f.path, MAX_LOCATIONS);
+      return 1;
+    }
+  }
+
+  for (const Fixture &f : fixtures) {
+    parse(f);
+    double parse_us = best_us([&] { parse(f); });
+    double fixed_us = best_us([] {
+      for (const WeatherModel &m : models) fixed_labels(m);
+    });
+    double printf_us = best_us([] {
+      for (const WeatherModel &m : models) printf_labels(m);
+    });
+    printf("%s, %zu bytes, %d locations\n", f.path, f.len, MAX_LOCATIONS);
+    printf("  parse %7.2f us   labels %6.2f us (printf %6.2f us)   refresh %7.2f us\n",
+           parse_us, fixed_us, printf_us, parse_us + fixed_us);
+  }
+  printf("checksum %08x\n", checksum);
+  return 0;
+}
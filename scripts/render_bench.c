@@ -0,0 +1,206 @@
+// Host benchmark of the screen background behind a clock-only update, the
+// redraw the display makes every second, before and after the cached
+// bands in src/main.cpp. It times the pixel work of the background in the
+// clock label's area:
+//   - gradient: as LVGL 9.2's lv_draw_sw_fill() draws the screen's
+//     LV_GRAD_DIR_VER background, allocating a color map the height of
+//     the screen, interpolating every entry of it, then filling the
+//     redrawn rows one at a time;
+//   - bands: as screen_background_draw_cb() draws it, intersecting the
+//     cached RGB565 bands with the redrawn area and filling those that
+//     cross it.
+// Both fill with the kernels in src/lv_blend_aura.c, as on the device. The
+// same is timed for a full redraw, in the display's 32-row draw buffer
+// chunks, to check that case did not get slower.
+//
+//     make render-bench
+//
+// Not included, as both versions spend the same: LVGL's draw task
+// dispatch (one task per band crossed, against one for the gradient), the
+// clock's glyphs, and the SPI transfer, which dominates a real frame.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "lv_blend_aura.h"
+#include "theme.h"
+
+// As in src/main.cpp
+#define SCREEN_WIDTH 240
+#define SCREEN_HEIGHT 320
+#define DRAW_BUF_ROWS (SCREEN_HEIGHT / 10)
+#define MAX_BG_BANDS 64
+
+// lbl_clock, 14 px, aligned top right with a 10 px margin; wide enough
+// for "12:59PM"
+#define CLOCK_X1 178
+#define CLOCK_Y1 2
+#define CLOCK_W 52
+#define CLOCK_H 16
+
+#define RUNS 5
+#define ROUNDS 20000
+
+typedef struct {
+  int32_t x1, y1, x2, y2;
+} Area;
+
+typedef struct {
+  uint8_t red, green, blue;
+} Color;
+
+typedef struct {
+  int16_t y1, y2;
+  uint16_t color;
+} Band;
+
+static Band bands[MAX_BG_BANDS];
+static int band_count = 0;
+static uint16_t layer_buf[SCREEN_WIDTH * DRAW_BUF_ROWS] __attribute__((aligned(4)));
+static unsigned checksum = 0;
+
+#define UDIV255(x) (((x) * 0x8081U) >> 0x17)
+
+static Color color_hex(uint32_t c) {
+  Color ret = {(uint8_t)(c >> 16), (uint8_t)(c >> 8), (uint8_t)c};
+  return ret;
+}
+
+static uint16_t color_to_u16(Color c) {
+  return ((c.red & 0xF8) << 8) + ((c.green & 0xFC) << 3) + ((c.blue & 0xF8) >> 3);
+}
+
+// lv_color_mix() from LVGL 9.2
+static Color color_mix(Color c1, Color c2, uint8_t mix) {
+  Color ret;
+  ret.red = UDIV255((uint16_t)c1.red * mix + c2.red * (255 - mix));
+  ret.green = UDIV255((uint16_t)c1.green * mix + c2.green * (255 - mix));
+  ret.blue = UDIV255((uint16_t)c1.blue * mix + c2.blue * (255 - mix));
+  return ret;
+}
+
+// build_background_bands() in src/main.cpp
+static void build_bands(void) {
+  Color top = color_hex(BG_GRAD_TOP);
+  Color bottom = color_hex(BG_GRAD_BOTTOM);
+  uint16_t prev = 0;
+  for (int y = 0; y < SCREEN_HEIGHT; y++) {
+    uint16_t c16 = color_to_u16(color_mix(bottom, top, y * 255 / (SCREEN_HEIGHT - 1)));
+    if (band_count > 0 && (c16 == prev || band_count == MAX_BG_BANDS)) {
+      bands[band_count - 1].y2 = y;
+      continue;
+    }
+    bands[band_count].y1 = bands[band_count].y2 = y;
+    bands[band_count++].color = c16;
+    prev = c16;
+  }
+}
+
+static int intersect(Area *out, const Area *a, const Area *b) {
+  out->x1 = a->x1 > b->x1 ? a->x1 : b->x1;
+  out->y1 = a->y1 > b->y1 ? a->y1 : b->y1;
+  out->x2 = a->x2 < b->x2 ? a->x2 : b->x2;
+  out->y2 = a->y2 < b->y2 ? a->y2 : b->y2;
+  return out->x1 <= out->x2 && out->y1 <= out->y2;
+}
+
+// Fill part of the layer, which covers clip, with a solid color
+static void fill(const Area *clip, const Area *area, uint16_t color) {
+  int32_t stride = (clip->x2 - clip->x1 + 1) * 2;
+  uint16_t *dest = layer_buf + (area->y1 - clip->y1) * (stride / 2) + (area->x1 - clip->x1);
+  aura_fill_rgb565(dest, area->x2 - area->x1 + 1, area->y2 - area->y1 + 1, stride, color);
+}
+
+// lv_gradient_color_calculate() from LVGL 9.2, for the two stops at 0 and
+// 255 that a bg_color/bg_grad_color pair makes
+static uint16_t gradient_color(Color one, Color two, int32_t range, int32_t frac) {
+  int32_t max = (255 * range) >> 8;
+  if (frac <= 0) return color_to_u16(one);
+  if (frac >= max) return color_to_u16(two);
+  uint8_t mix = (uint8_t)(frac * 255 / max);
+  uint8_t imix = 255 - mix;
+  Color c = {(uint8_t)UDIV255(two.red * mix + one.red * imix), (uint8_t)UDIV255(two.green * mix + one.green * imix),
+             (uint8_t)UDIV255(two.blue * mix + one.blue * imix)};
+  return color_to_u16(c);
+}
+
+// The screen's vertical gradient, as lv_draw_sw_fill() draws it into a
+// layer covering clip: lv_gradient_get() then one fill per row
+static void draw_gradient(const Area *clip) {
+  Color top = color_hex(BG_GRAD_TOP);
+  Color bottom = color_hex(BG_GRAD_BOTTOM);
+  uint16_t *color_map = malloc(SCREEN_HEIGHT * (sizeof(uint16_t) + 1));
+  for (int32_t i = 0; i < SCREEN_HEIGHT; i++) color_map[i] = gradient_color(top, bottom, SCREEN_HEIGHT, i);
+
+  for (int32_t y = clip->y1; y <= clip->y2; y++) {
+    Area row = {clip->x1, y, clip->x2, y};
+    fill(clip, &row, color_map[y]);
+  }
+  checksum += color_map[clip->y1];
+  free(color_map);
+}
+
+// screen_background_draw_cb() in src/main.cpp
+static void draw_bands(const Area *clip) {
+  for (int i = 0; i < band_count; i++) {
+    Area band = {0, bands[i].y1, SCREEN_WIDTH - 1, bands[i].y2};
+    Area clipped;
+    if (!intersect(&clipped, &band, clip)) continue;
+    fill(clip, &clipped, bands[i].color);
+  }
+  checksum += layer_buf[0];
+}
+
+static double now_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+// Best of RUNS, per frame; a frame redraws every area in turn
+static double frame_us(void (*draw)(const Area *), const Area *areas, int count) {
+  double best = 1e30;
+  for (int run = 0; run < RUNS; run++) {
+    double start = now_us();
+    for (int i = 0; i < ROUNDS; i++) {
+      for (int a = 0; a < count; a++) draw(&areas[a]);
+    }
+    double us = (now_us() - start) / ROUNDS;
+    if (us < best) best = us;
+  }
+  return best;
+}
+
+static void report(const char *name, const Area *areas, int count) {
+  int crossed = 0;
+  for (int a = 0; a < count; a++) {
+    for (int i = 0; i < band_count; i++) {
+      Area band = {0, bands[i].y1, SCREEN_WIDTH - 1, bands[i].y2};
+      Area clipped;
+      crossed += intersect(&clipped, &band, &areas[a]);
+    }
+  }
+  double gradient = frame_us(draw_gradient, areas, count);
+  double banded = frame_us(draw_bands, areas, count);
+  printf("%-13s gradient %8.2f us   bands %8.2f us (%d fills)   %.1fx\n", name, gradient, banded, crossed,
+         gradient / banded);
+}
+
+int main(void) {
+  build_bands();
+  printf("Background: %d bands of %dx%d\n", band_count, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+  Area clock = {CLOCK_X1, CLOCK_Y1, CLOCK_X1 + CLOCK_W - 1, CLOCK_Y1 + CLOCK_H - 1};
+  report("clock update", &clock, 1);
+
+  Area chunks[SCREEN_HEIGHT / DRAW_BUF_ROWS];
+  for (int i = 0; i < SCREEN_HEIGHT / DRAW_BUF_ROWS; i++) {
+    Area chunk = {0, i * DRAW_BUF_ROWS, SCREEN_WIDTH - 1, (i + 1) * DRAW_BUF_ROWS - 1};
+    chunks[i] = chunk;
+  }
+  report("full redraw", chunks, SCREEN_HEIGHT / DRAW_BUF_ROWS);
+
+  printf("checksum %08x\n", checksum);
+  return 0;
+}
@@ -2,21 +2,33 @@
 """
 Download and resize weather images for LVGL.
 Converts images from 100x100 to 64x64 to reduce flash usage for OTA support.
+
+Also pre-blends the 20x20 forecast icons onto the panel color from
+include/theme.h, writing opaque RGB565 copies to assets/icons_on_panel.c so
+they are drawn with a plain copy instead of per-pixel alpha blending.
+Run with --icons to only regenerate the pre-blended icons.
+
+The images are written to assets/ and packed into the asset partition by
+scripts/build_assets.py rather than compiled into the app.
 """
 
 import os
+import re
 import sys
-import struct
 from pathlib import Path
 
-try:
-    from PIL import Image
-    import requests
-except ImportError:
-    print("Installing required packages...")
-    os.system(f"{sys.executable} -m pip install Pillow requests")
-    from PIL import Image
-    import requests
+
+def import_imaging():
+    """Import Pillow and requests, installing them if needed."""
+    global Image, requests
+    try:
+        from PIL import Image
+        import requests
+    except ImportError:
+        print("Installing required packages...")
+        os.system(f"{sys.executable} -m pip install Pillow requests")
+        from PIL import Image
+        import requests
 
 # Image mappings: local name -> GitHub raw URL
 GITHUB_BASE = "https://raw.githubusercontent.com/mrdarrengriffin/google-weather-icons/main/v2"
@@ -70,7 +82,7 @@ def rgb888_to_rgb565(r: int, g: int, b: int) -> int:
     return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
 
 
-def generate_lvgl_c_file(image_name: str, img: Image.Image, output_path: Path):
+def generate_lvgl_c_file(image_name: str, img, output_path: Path):
     """Generate LVGL C source file from PIL Image."""
     width, height = img.size
     
@@ -165,15 +177,111 @@ const lv_image_dsc_t {var_name} = {{
     output_path.write_text(c_content)
 
 
+def read_define(header: Path, name: str) -> int:
+    """Value of an integer #define in a C header."""
+    match = re.search(rf"^#define\s+{name}\s+(0x[0-9a-fA-F]+|\d+)", header.read_text(), re.MULTILINE)
+    if not match:
+        raise ValueError(f"{name} not found in {header}")
+    return int(match.group(1), 0)
+
+
+def load_rgb565a8(path: Path):
+    """Read width, height and the raw map bytes of an LVGL RGB565A8 C image."""
+    text = path.read_text()
+    width = int(re.search(r"\.header\.w = (\d+)", text).group(1))
+    height = int(re.search(r"\.header\.h = (\d+)", text).group(1))
+    body = text[text.index("_map[] = {") + 10:text.index("};")]
+    data = bytes(int(v, 16) for v in re.findall(r"0x([0-9a-fA-F]{2})", body))
+    if len(data) != width * height * 3:
+        raise ValueError(f"{path.name} is not a {width}x{height} RGB565A8 image")
+    return width, height, data
+
+
+def mix_rgb565(fg: int, bg: int, mix: int) -> int:
+    """Blend two RGB565 colors exactly like LVGL's lv_color_16_16_mix()."""
+    if mix >= 255:
+        return fg
+    if mix == 0:
+        return bg
+    mix = (mix + 4) >> 3
+    bg32 = (bg | (bg << 16)) & 0x07E0F81F
+    fg32 = (fg | (fg << 16)) & 0x07E0F81F
+    result = ((((fg32 - bg32) * mix) >> 5) + bg32) & 0x07E0F81F
+    return ((result >> 16) | result) & 0xFFFF
+
+
+def preblend_icons(project_root: Path) -> int:
+    """Write opaque copies of every icon_*.c composited onto the panel color."""
+    assets_dir = project_root / "assets"
+    panel = read_define(project_root / "include" / "theme.h", "PANEL_BG_COLOR")
+    r, g, b = (panel >> 16) & 0xFF, (panel >> 8) & 0xFF, panel & 0xFF
+    panel565 = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+    names = sorted(p.stem for p in assets_dir.glob("icon_*.c"))
+    source = [
+        "/*******************************************************************************",
+        " * Forecast icons pre-blended onto the panel color - generated by",
+        " * scripts/resize_images.py, do not edit",
+        " ******************************************************************************/",
+        "",
+        '#include "lvgl.h"',
+        "",
+        "/* Panel color the icons were blended onto, read by scripts/build_assets.py */",
+        f"#define ICON_PANEL_BLEND_COLOR 0x{panel:06x}",
+    ]
+
+    for name in names:
+        width, height, data = load_rgb565a8(assets_dir / f"{name}.c")
+        count = width * height
+        pixels = []
+        for i in range(count):
+            fg = data[2 * i] | (data[2 * i + 1] << 8)
+            pixels.append(mix_rgb565(fg, panel565, data[2 * count + i]))
+
+        var = f"{name}_on_panel"
+        source += ["", f"static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t {var}_map[] = {{"]
+        for row in range(height):
+            line = pixels[row * width:(row + 1) * width]
+            source.append("    " + ",".join(f"0x{p & 0xFF:02x},0x{p >> 8:02x}" for p in line) + ",")
+        source += [
+            "};",
+            "",
+            f"const lv_image_dsc_t {var} = {{",
+            "  .header.magic = LV_IMAGE_HEADER_MAGIC,",
+            "  .header.cf = LV_COLOR_FORMAT_RGB565,",
+            "  .header.flags = 0,",
+            f"  .header.w = {width},",
+            f"  .header.h = {height},",
+            f"  .header.stride = {width * 2},",
+            "  .header.reserved_2 = 0,",
+            f"  .data_size = sizeof({var}_map),",
+            f"  .data = {var}_map,",
+            "  .reserved = NULL,",
+            "};",
+        ]
+
+    source.append("")
+    (assets_dir / "icons_on_panel.c").write_text("\n".join(source))
+    return len(names)
+
+
 def main():
     script_dir = Path(__file__).parent
     project_root = script_dir.parent
-    src_dir = project_root / "src"
+    assets_dir = project_root / "assets"
+
+    count = preblend_icons(project_root)
+    print(f"Pre-blended {count} icons onto the panel color in assets/icons_on_panel.c")
+    if "--icons" in sys.argv:
+        return
+    print()
+
+    import_imaging()
     cache_dir = script_dir / "image_cache"
     cache_dir.mkdir(exist_ok=True)
     
     print(f"Resizing weather images to {TARGET_SIZE}x{TARGET_SIZE}...")
-    print(f"Output directory: {src_dir}")
+    print(f"Output directory: {assets_dir}")
     print()
     
     success_count = 0
@@ -197,7 +305,7 @@ def main():
             img = img.resize((TARGET_SIZE, TARGET_SIZE), Image.Resampling.LANCZOS)
             
             # Generate C file
-            output_path = src_dir / f"{image_name}.c"
+            output_path = assets_dir / f"{image_name}.c"
             generate_lvgl_c_file(image_name, img, output_path)
             
             print(f"  Generated {output_path.name}")
@@ -212,8 +320,8 @@ def main():
     
     if success_count > 0:
         print()
-        print("Now rebuild the project:")
-        print("  pio run")
+        print("Now repack and flash the asset partition:")
+        print("  make upload-assets")
 
 
 if __name__ == "__main__":
@@ -0,0 +1,366 @@
+// Host soak of the refresh pipeline. Each cycle is one forecast interval
+// on a fake clock:
+//   - a forecast response streamed through OpenMeteoParser into models in
+//     the refresh arena, then copied out and formatted into labels as
+//     render_weather() and the forecast panels do;
+//   - arrivals for three bus stops streamed through ArrivalParser, and
+//     every eighth cycle the 68 KB Oxford Circus response, which alone
+//     costs more than the rest of a cycle;
+//   - an offline location search, formatted as the results dropdown.
+// The responses are the recordings in scripts/fixtures, taken in turn with
+// synthetic forecasts whose values change every cycle.
+//
+// malloc, realloc, free and operator new are routed (-Wl,--wrap) to a
+// first-fit heap the size of the ESP32's free DRAM. Every cycle feeds a
+// sample of it to SoakMonitor, the same check the device soak uses, and
+// the run fails as soon as the heap floor grows or fragments. Each report
+// also gives the refresh arena's high-water mark and the smallest largest
+// free block of the heap so far; running the arena or the heap out fails
+// the run, even during SoakMonitor's warm-up.
+//
+//     make soak-test [SOAK_CYCLES=1000000]
+//
+// --leak BYTES leaks that much per cycle, to see the check fail. LVGL is
+// not built on the host, so widget churn (panel slides, the settings
+// window) is left to the device soak, pio run -e soak.
+
+#include <new>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "arena.h"
+#include "city_index.h"
+#include "open_meteo.h"
+#include "schedule.h"
+#include "soak.h"
+#include "str_builder.h"
+#include "tfl_arrivals.h"
+
+// As in src/main.cpp
+#define MAX_LOCATIONS 3
+#define MAX_BUS_STOPS 3
+#define MAX_GEO_RESULTS 15
+#define REFRESH_ARENA_SIZE (8 * 1024)
+#define STREAM_CHUNK 256            // stream_body()'s read buffer
+
+#define SOAK_WINDOW 1000            // Cycles per heap growth check
+#define SOAK_WARMUP_WINDOWS 5
+#define SOAK_TOLERANCE 1024         // Bytes the heap floor may rise
+#define SOAK_JSON_MAX 4096
+#define SOAK_BUS_ARRIVALS 12
+#define SOAK_EPOCH 1700000000
+#define SOAK_TUBE_EVERY 8
+
+// ---- Simulated heap ----
+
+#define HEAP_SIZE (160 * 1024)      // Free internal DRAM with WiFi up, roughly
+
+struct Block {
+  uint32_t size;  // Including this header
+  uint32_t used;
+  uint32_t pad[2];  // Keeps payloads 16-byte aligned for the host's new
+};
+
+static uint8_t heap[HEAP_SIZE] __attribute__((aligned(16)));
+static bool heap_ready = false;
+static uint32_t heap_in_use = 0;
+static uint32_t heap_failures = 0;
+
+static Block *next_block(Block *b) { return (Block *)((uint8_t *)b + b->size); }
+static Block *heap_end() { return (Block *)(heap + HEAP_SIZE); }
+
+extern "C" void *__real_malloc(size_t size);
+
+extern "C" void *__wrap_malloc(size_t size) {
+  if (!heap_ready) {
+    Block *b = (Block *)heap;
+    b->size = HEAP_SIZE;
+    b->used = 0;
+    heap_ready = true;
+  }
+  size_t need = (sizeof(Block) + (size ? size : 1) + 15) & ~(size_t)15;
+  for (Block *b = (Block *)heap; b < heap_end(); b = next_block(b)) {
+    if (b->used || b->size < need) continue;
+    if (b->size - need >= 2 * sizeof(Block)) {
+      Block *rest = (Block *)((uint8_t *)b + need);
+      rest->size = b->size - need;
+      rest->used = 0;
+      b->size = need;
+    }
+    b->used = 1;
+    heap_in_use += b->size;
+    return b + 1;
+  }
+  heap_failures++;
+  return nullptr;
+}
+
+extern "C" void __wrap_free(void *ptr) {
+  if (!ptr) return;
+  Block *b = (Block *)ptr - 1;
+  b->used = 0;
+  heap_in_use -= b->size;
+  for (Block *p = (Block *)heap; p < heap_end(); p = next_block(p)) {
+    while (!p->used && next_block(p) < heap_end() && !next_block(p)->used) {
+      p->size += next_block(p)->size;
+    }
+  }
+}
+
+extern "C" void *__wrap_calloc(size_t n, size_t size) {
+  void *ptr = __wrap_malloc(n * size);
+  if (ptr) memset(ptr, 0, n * size);
+  return ptr;
+}
+
+extern "C" void *__wrap_realloc(void *ptr, size_t size) {
+  void *fresh = __wrap_malloc(size);
+  if (fresh && ptr) {
+    size_t old = ((Block *)ptr - 1)->size - sizeof(Block);
+    memcpy(fresh, ptr, old < size ? old : size);
+    __wrap_free(ptr);
+  }
+  return fresh;
+}
+
+void *operator new(size_t size) {
+  void *ptr = malloc(size);
+  if (!ptr) throw std::bad_alloc();
+  return ptr;
+}
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *ptr) noexcept { free(ptr); }
+void operator delete[](void *ptr) noexcept { free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { free(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { free(ptr); }
+
+static HeapSample heap_sample() {
+  HeapSample s = {};
+  s.in_use = heap_in_use;
+  s.free = HEAP_SIZE - heap_in_use;
+  s.largest_free = heap_ready ? 0 : HEAP_SIZE;
+  for (Block *b = (Block *)heap; heap_ready && b < heap_end(); b = next_block(b)) {
+    if (!b->used && b->size > s.largest_free) s.largest_free = b->size;
+  }
+  return s;
+}
+
+// ---- Fixtures ----
+
+struct Fixture {
+  const char *path;
+  int locations;  // Forecasts only
+  char *body;
+  size_t len;
+};
+
+static Fixture forecasts[] = {
+  {"scripts/fixtures/forecast/3-locations.json", 3, nullptr, 0},
+  {"scripts/fixtures/forecast/3-locations-fahrenheit.json", 3, nullptr, 0},
+};
+static Fixture tube = {"scripts/fixtures/arrivals/940GZZLUOXC.json", 0, nullptr, 0};
+static Fixture search = {"scripts/fixtures/search/san.json", 0, nullptr, 0};
+
+// Read outside the simulated heap, so the fixtures are not part of it
+static bool load_fixture(Fixture &f) {
+  FILE *file = fopen(f.path, "rb");
+  if (!file) {
+    printf("Cannot open %s\n", f.path);
+    return false;
+  }
+  fseek(file, 0, SEEK_END);
+  f.len = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  f.body = (char *)__real_malloc(f.len + 1);
+  f.len = fread(f.body, 1, f.len, file);
+  f.body[f.len] = '\0';
+  fclose(file);
+  return true;
+}
+
+// Search prefixes: every leading part of the fixture's result names
+static char queries[64][32];
+static int query_count = 0;
+
+static void load_queries() {
+  const char *p = search.body;
+  while (query_count < 64 && (p = strstr(p, "\"name\":\""))) {
+    p += 8;
+    const char *end = strchr(p, '"');
+    for (size_t len = 1; len <= (size_t)(end - p) && len < 32 && query_count < 64; len += 3) {
+      memcpy(queries[query_count], p, len);
+      queries[query_count++][len] = '\0';
+    }
+    p = end;
+  }
+}
+
+// ---- One cycle ----
+
+static uint8_t refresh_arena_mem[REFRESH_ARENA_SIZE];
+static Arena refresh_arena(refresh_arena_mem, sizeof(refresh_arena_mem));
+static uint32_t sim_ms = 0;
+
+static WeatherModel weather[MAX_LOCATIONS];
+static ArrivalInfo bus_arrivals[ARRIVALS_SHOWN];
+static ArrivalInfo tube_arrivals[ARRIVALS_SHOWN];
+static char labels[64][24];
+static char dd_opts[MAX_GEO_RESULTS * 64];
+static uint32_t checksum = 0;  // Keeps the formatting from being optimized away
+static void *volatile leaked;   // --leak, never freed
+
+template <typename Parser>
+static void stream(Parser &parser, const char *body, size_t len) {
+  for (size_t at = 0; at < len && !parser.complete(); at += STREAM_CHUNK) {
+    parser.feed(body + at, len - at < STREAM_CHUNK ? len - at : STREAM_CHUNK);
+  }
+}
+
+static void format_labels(const WeatherModel &m) {
+  int n = 0;
+  char unit = m.fahrenheit ? 'F' : 'C';
+  StrBuilder(labels[n++], sizeof(labels[0])).add_int(fixed_round(m.t_now, 10)).add("°").add(unit);
+  StrBuilder(labels[n++], sizeof(labels[0])).add_int(fixed_round(m.t_feels, 10)).add("°").add(unit);
+  for (int i = 0; i < FORECAST_DAYS; i++) {
+    StrBuilder(labels[n++], sizeof(labels[0])).add_int(fixed_round(m.daily[i].t_min, 10)).add("°").add(unit);
+    StrBuilder(labels[n++], sizeof(labels[0])).add_int(fixed_round(m.daily[i].t_max, 10)).add("°").add(unit);
+  }
+  for (int i = 0; i < FORECAST_HOURS; i++) {
+    const HourlyForecast &h = m.hourly[i];
+    StrBuilder(labels[n++], sizeof(labels[0])).add_int(local_hour(h.time, m.utc_offset_seconds), 2);
+    format_precip(labels[n++], sizeof(labels[0]), h.precip, m.fahrenheit);
+  }
+  for (int i = 0; i < n; i++) checksum += (uint8_t)labels[i][0];
+}
+
+static bool refresh_weather(uint32_t cycle) {
+  ArenaScope scratch(refresh_arena);
+  const char *body;
+  size_t len;
+  int count;
+  char *json = nullptr;
+
+  // Recordings in turn, every third cycle a synthetic forecast
+  if (cycle % 3 < 2) {
+    const Fixture &f = forecasts[cycle % 3];
+    body = f.body;
+    len = f.len;
+    count = f.locations;
+  } else {
+    count = 1 + cycle / 3 % MAX_LOCATIONS;
+    json = (char *)refresh_arena.alloc(SOAK_JSON_MAX);
+    if (!json) return false;
+    len = soak_forecast_json(json, SOAK_JSON_MAX, count, cycle, SOAK_EPOCH + sim_ms / 1000);
+    body = json;
+  }
+
+  WeatherModel *models = (WeatherModel *)refresh_arena.alloc(sizeof(WeatherModel) * count);
+  if (!models) return false;
+  OpenMeteoParser parser(models, count);
+  stream(parser, body, len);
+  if (parser.parsed() != count) return false;
+
+  for (int i = 0; i < count; i++) {
+    weather[i] = models[i];
+    weather[i].fahrenheit = cycle % 3 == 1;  // As apply_forecast() sets it
+    format_labels(weather[i]);
+  }
+  return true;
+}
+
+static bool refresh_transit(uint32_t cycle) {
+  char json[SOAK_JSON_MAX];
+  ArrivalTopK bus_top;
+  ArrivalParser bus_parser(bus_top, false);
+  for (int stop = 0; stop < MAX_BUS_STOPS; stop++) {
+    size_t len = soak_arrivals_json(json, sizeof(json), SOAK_BUS_ARRIVALS, cycle * MAX_BUS_STOPS + stop);
+    bus_parser.reset();
+    stream(bus_parser, json, len);
+    if (!bus_parser.complete()) return false;
+  }
+  int bus_count = bus_top.take_sorted(bus_arrivals);
+  for (int i = 0; i < bus_count; i++) checksum += bus_arrivals[i].timeToStation;
+  if (cycle % SOAK_TUBE_EVERY) return bus_count > 0;
+
+  ArrivalTopK tube_top;
+  ArrivalParser tube_parser(tube_top, true);
+  stream(tube_parser, tube.body, tube.len);
+  if (!tube_parser.complete()) return false;
+  int tube_count = tube_top.take_sorted(tube_arrivals);
+
+  for (int i = 0; i < tube_count; i++) checksum += tube_arrivals[i].timeToStation;
+  return bus_count > 0 && tube_count > 0;
+}
+
+static void search_locations(uint32_t cycle) {
+  const CityRecord *cities[MAX_GEO_RESULTS];
+  size_t count = city_index_search(queries[cycle % query_count], cities, MAX_GEO_RESULTS);
+  StrBuilder opts(dd_opts, sizeof(dd_opts));
+  for (size_t i = 0; i < count; i++) {
+    if (i > 0) opts.add('\n');
+    opts.add(city_name(cities[i]));
+    if (city_admin1(cities[i])) opts.add(", ").add(city_admin1(cities[i]));
+  }
+  checksum += opts.length();
+}
+
+static double now_s() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv) {
+  uint32_t cycles = 1000000;
+  uint32_t leak = 0;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--leak") && i + 1 < argc) {
+      leak = strtoul(argv[++i], nullptr, 10);
+    } else {
+      cycles = strtoul(argv[i], nullptr, 10);
+    }
+  }
+
+  for (Fixture &f : forecasts) {
+    if (!load_fixture(f)) return 1;
+  }
+  if (!load_fixture(tube) || !load_fixture(search)) return 1;
+  load_queries();
+  printf("Soak: %u cycles of %lu simulated minutes, %u cities in the offline index\n",
+         cycles, UPDATE_INTERVAL / 60000, city_record_count);
+
+  SoakMonitor monitor(SOAK_WINDOW, SOAK_WARMUP_WINDOWS, SOAK_TOLERANCE);
+  uint32_t min_largest_free = HEAP_SIZE;
+  char report[160];
+  double start = now_s();
+  for (uint32_t cycle = 0; cycle < cycles; cycle++) {
+    if (!refresh_weather(cycle)) {
+      printf("Cycle %u: %s\n", cycle, refresh_arena.failures() ? "refresh arena full" : "forecast did not parse");
+      return 1;
+    }
+    if (!refresh_transit(cycle)) {
+      printf("Cycle %u: arrivals did not parse\n", cycle);
+      return 1;
+    }
+    search_locations(cycle);
+    if (leak) leaked = malloc(leak);
+    sim_ms += UPDATE_INTERVAL;
+
+    HeapSample sample = heap_sample();
+    if (sample.largest_free < min_largest_free) min_largest_free = sample.largest_free;
+    bool ok = monitor.sample(sample) && !heap_failures;
+    if (!ok || (cycle + 1) % (cycles / 10 ? cycles / 10 : 1) == 0) {
+      monitor.report(report, sizeof(report));
+      if (heap_failures) snprintf(report, sizeof(report), "%u allocations failed, heap full", heap_failures);
+      printf("%s after %.0f simulated days: %s\n", ok ? "Soak" : "FAIL",
+             (cycle + 1) * (double)UPDATE_INTERVAL / 86400000.0, report);
+      printf("  refresh arena high water %u of %u bytes, smallest largest free block %u\n",
+             (unsigned)refresh_arena.high_water(), (unsigned)refresh_arena.capacity(), min_largest_free);
+    }
+    if (!ok) return 1;
+  }
+  printf("%u cycles in %.1f s (checksum %08x)\n", cycles, now_s() - start, checksum);
+  return 0;
+}
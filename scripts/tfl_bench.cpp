@@ -0,0 +1,237 @@
+// Host benchmark of the TfL arrivals parser (src/tfl_arrivals.cpp) against
+// the ArduinoJson path it replaced, over the recordings given on the
+// command line. For each it reports the time per response, the peak heap
+// and the soonest arrivals found by:
+//   - stream: the body fed in 256-byte chunks, as stream_body() reads it;
+//   - arduinojson: the old fetch_tube_arrivals(): the body copied as by
+//     http.getString(), deserialized whole into a JsonDocument, and the
+//     first ten arrivals bubble sorted;
+//   - filtered: ArduinoJson at its best, keeping only the four fields
+//     with a filter and offering every arrival to the same top-K heap.
+//
+//     make tfl-bench
+//
+// ArduinoJson is only on disk once a firmware build has fetched it
+// (ARDUINOJSON_DIR, .pio/libdeps/esp32dev/ArduinoJson); without it only
+// the streaming parser is measured.
+
+#include <new>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "tfl_arrivals.h"
+
+#ifdef TFL_BENCH_ARDUINOJSON
+#include <ArduinoJson.h>
+#endif
+
+#define ROUNDS 200
+#define RUNS 5
+#define STREAM_CHUNK 256
+
+// ---- Heap accounting ----
+
+struct AllocHeader {
+  size_t size;
+  size_t pad;  // Keeps payloads 16-byte aligned
+};
+
+static size_t heap_in_use = 0;
+static size_t heap_peak = 0;
+
+extern "C" void *__real_malloc(size_t size);
+extern "C" void __real_free(void *ptr);
+
+extern "C" void *__wrap_malloc(size_t size) {
+  AllocHeader *h = (AllocHeader *)__real_malloc(sizeof(AllocHeader) + size);
+  if (!h) return nullptr;
+  h->size = size;
+  heap_in_use += size;
+  if (heap_in_use > heap_peak) heap_peak = heap_in_use;
+  return h + 1;
+}
+
+extern "C" void __wrap_free(void *ptr) {
+  if (!ptr) return;
+  AllocHeader *h = (AllocHeader *)ptr - 1;
+  heap_in_use -= h->size;
+  __real_free(h);
+}
+
+extern "C" void *__wrap_calloc(size_t n, size_t size) {
+  void *ptr = __wrap_malloc(n * size);
+  if (ptr) memset(ptr, 0, n * size);
+  return ptr;
+}
+
+extern "C" void *__wrap_realloc(void *ptr, size_t size) {
+  void *fresh = __wrap_malloc(size);
+  if (fresh && ptr) {
+    size_t old = ((AllocHeader *)ptr - 1)->size;
+    memcpy(fresh, ptr, old < size ? old : size);
+    __wrap_free(ptr);
+  }
+  return fresh;
+}
+
+void *operator new(size_t size) {
+  void *ptr = malloc(size);
+  if (!ptr) throw std::bad_alloc();
+  return ptr;
+}
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *ptr) noexcept { free(ptr); }
+void operator delete[](void *ptr) noexcept { free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { free(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { free(ptr); }
+
+// ---- The three paths ----
+
+typedef int (*ArrivalsPath)(const char *body, size_t len, ArrivalInfo *out);
+
+static int stream_arrivals(const char *body, size_t len, ArrivalInfo *out) {
+  ArrivalTopK top;
+  ArrivalParser parser(top, true);
+  for (size_t at = 0; at < len && !parser.complete(); at += STREAM_CHUNK) {
+    parser.feed(body + at, len - at < STREAM_CHUNK ? len - at : STREAM_CHUNK);
+  }
+  return parser.complete() ? top.take_sorted(out) : -1;
+}
+
+#ifdef TFL_BENCH_ARDUINOJSON
+static void copy_field(char *dst, size_t size, const char *src) {
+  strncpy(dst, src, size - 1);
+  dst[size - 1] = '\0';
+}
+
+static int arduinojson_arrivals(const char *body, size_t len, ArrivalInfo *out) {
+  char *payload = (char *)malloc(len + 1);  // http.getString()
+  memcpy(payload, body, len);
+  payload[len] = '\0';
+
+  int shown = -1;
+  {
+    JsonDocument doc;
+    if (deserializeJson(doc, (const char *)payload, len) == DeserializationError::Ok) {
+      JsonArray arrivals = doc.as<JsonArray>();
+      int count = (int)arrivals.size() < 10 ? (int)arrivals.size() : 10;
+      int indices[10];
+      int times[10];
+      for (int i = 0; i < count; i++) {
+        indices[i] = i;
+        times[i] = arrivals[i]["timeToStation"].as<int>();
+      }
+      for (int i = 0; i < count - 1; i++) {
+        for (int j = 0; j < count - i - 1; j++) {
+          if (times[j] > times[j + 1]) {
+            int t = times[j];
+            times[j] = times[j + 1];
+            times[j + 1] = t;
+            t = indices[j];
+            indices[j] = indices[j + 1];
+            indices[j + 1] = t;
+          }
+        }
+      }
+      shown = count < ARRIVALS_SHOWN ? count : ARRIVALS_SHOWN;
+      for (int i = 0; i < shown; i++) {
+        JsonObject arrival = arrivals[indices[i]];
+        const char *destination = arrival["towards"];
+        if (!destination) destination = arrival["destinationName"] | "?";
+        copy_field(out[i].line, sizeof(out[i].line), arrival["lineName"] | "?");
+        copy_field(out[i].destination, sizeof(out[i].destination), destination);
+        out[i].timeToStation = times[i];
+      }
+    }
+  }
+  free(payload);
+  return shown;
+}
+
+static int filtered_arrivals(const char *body, size_t len, ArrivalInfo *out) {
+  JsonDocument filter;
+  filter[0]["lineName"] = true;
+  filter[0]["destinationName"] = true;
+  filter[0]["towards"] = true;
+  filter[0]["timeToStation"] = true;
+
+  JsonDocument doc;
+  if (deserializeJson(doc, body, len, DeserializationOption::Filter(filter)) != DeserializationError::Ok) return -1;
+  ArrivalTopK top;
+  for (JsonObject arrival : doc.as<JsonArray>()) {
+    ArrivalInfo info;
+    const char *destination = arrival["towards"];
+    if (!destination) destination = arrival["destinationName"] | "?";
+    copy_field(info.line, sizeof(info.line), arrival["lineName"] | "?");
+    copy_field(info.destination, sizeof(info.destination), destination);
+    info.timeToStation = arrival["timeToStation"].as<int>();
+    top.offer(info);
+  }
+  return top.take_sorted(out);
+}
+#endif
+
+// ---- Measurement ----
+
+static double now_us() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void measure(const char *name, ArrivalsPath path, const char *body, size_t len) {
+  ArrivalInfo shown[ARRIVALS_SHOWN];
+  heap_in_use = heap_peak = 0;
+  int count = path(body, len, shown);
+  size_t peak = heap_peak;
+  if (count < 0) {
+    printf("  %-12s failed to parse\n", name);
+    return;
+  }
+
+  double best = 1e30;
+  for (int run = 0; run < RUNS; run++) {
+    double start = now_us();
+    for (int i = 0; i < ROUNDS; i++) path(body, len, shown);
+    double us = (now_us() - start) / ROUNDS;
+    if (us < best) best = us;
+  }
+
+  printf("  %-12s %8.1f us %7.1f MB/s %8zu B heap  ", name, best, len / best, peak);
+  for (int i = 0; i < count; i++) printf(" %s %ds", shown[i].line, shown[i].timeToStation);
+  printf("\n");
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    printf("usage: %s arrivals.json...\n", argv[0]);
+    return 1;
+  }
+  for (int i = 1; i < argc; i++) {
+    FILE *file = fopen(argv[i], "rb");
+    if (!file) {
+      printf("Cannot open %s\n", argv[i]);
+      return 1;
+    }
+    fseek(file, 0, SEEK_END);
+    size_t len = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char *body = (char *)__real_malloc(len);
+    len = fread(body, 1, len, file);
+    fclose(file);
+
+    printf("%s, %zu bytes\n", argv[i], len);
+    measure("stream", stream_arrivals, body, len);
+#ifdef TFL_BENCH_ARDUINOJSON
+    measure("arduinojson", arduinojson_arrivals, body, len);
+    measure("filtered", filtered_arrivals, body, len);
+#endif
+    __real_free(body);
+  }
+#ifndef TFL_BENCH_ARDUINOJSON
+  printf("ArduinoJson not found (ARDUINOJSON_DIR); build the firmware once to compare against it\n");
+#endif
+  return 0;
+}
@@ -0,0 +1,310 @@
+// Host simulation of a day of the device's network traffic, per host, for
+// a few configurations. A virtual clock advances in SIM_STEP_MS steps and
+// each step runs what the firmware's loop() would:
+//   - the LVGL timers that fetch or move panels: transit refresh, location
+//     rotation and auto-rotation, at the periods in include/schedule.h and
+//     in the order lv_timer_handler() runs them (newest first);
+//   - the end of a panel slide, which fetches arrivals when it lands on the
+//     transit panel; a transit refresh due during a slide is skipped;
+//   - poll_weather_refresh(), on the same Interval as the firmware;
+//   - location searches pressed with Enter, online only when the offline
+//     index has no match and the session's cache has no entry.
+// Each request is counted with traffic_record() against the body of its
+// recording in scripts/fixtures, chosen the way scripts/fault_server.py
+// chooses a replay, so the bytes in are those of real-sized responses.
+//
+//     make traffic-test
+//
+// The firmware's own simulation (make traffic, CONFIG_TRAFFIC_SIM) runs the
+// same day on the device against synthetic bodies.
+
+#include <dirent.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "city_index.h"
+#include "schedule.h"
+#include "str_builder.h"
+#include "traffic.h"
+
+// As in src/main.cpp
+#define SIM_STEP_MS 100
+#define SIM_DURATION_MS 86400000UL
+#define PANEL_SLIDE_TIME 300
+#define GEO_CACHE_ENTRIES 4
+#define MAX_GEO_RESULTS 15
+#define FORECAST_URL "http://api.open-meteo.com/v1/forecast"
+#define GEOCODE_URL "https://geocoding-api.open-meteo.com/v1/search"
+#define TFL_STOP_URL "https://api.tfl.gov.uk/StopPoint/"
+#define PANEL_DAILY 0
+#define PANEL_TRANSIT 2
+
+#define FIXTURES_DIR "scripts/fixtures"
+#define MAX_FIXTURES 32
+
+struct Scenario {
+  const char *name;
+  int locations;
+  bool fahrenheit;
+  int bus_stops;          // The first bus_stops of bus_stop_ids
+  bool tube;
+  bool auto_rotate;
+  int searches;           // Location dialogs a day, each searching one query with Enter
+};
+
+static const Scenario scenarios[] = {
+  {"1 location", 1, false, 0, false, false, 0},
+  {"3 locations, Fahrenheit", 3, true, 0, false, false, 0},
+  {"3 bus stops and a tube station", 1, false, 3, true, false, 0},
+  {"3 bus stops and a tube station, auto-rotate", 1, false, 3, true, true, 0},
+  {"3 locations, transit, auto-rotate, 6 searches", 3, false, 3, true, true, 6},
+};
+
+static const char *const bus_stop_ids[] = {"490000173RF", "490000173RB", "490008660N"};
+static const char *const tube_station_id = "940GZZLUOXC";
+static const char *const search_queries[] = {"San", "Hackney", "Zürich", "Gent"};
+static const char *const latitudes[] = {"51.5085", "48.8534", "40.7143"};
+static const char *const longitudes[] = {"-0.1257", "2.3488", "-74.006"};
+
+// ---- Fixtures, chosen as fault_server.py's load_fixture() does ----
+
+struct Fixture {
+  char kind[16];
+  char key[64];
+  char *body;
+  size_t len;
+  int locations;           // Forecasts: elements of the top-level array, or 1
+  size_t location_len[8];  // Forecasts: length of each location object
+};
+
+static Fixture fixtures[MAX_FIXTURES];
+static int fixture_count = 0;
+
+static void split_locations(Fixture &f) {
+  f.locations = 0;
+  if (f.body[0] != '[') {
+    f.locations = 1;
+    f.location_len[0] = f.len;
+    return;
+  }
+  int depth = 0;
+  bool in_string = false;
+  size_t start = 0;
+  for (size_t i = 1; i < f.len && f.locations < 8; i++) {
+    char c = f.body[i];
+    if (in_string) {
+      if (c == '\\') i++;
+      else if (c == '"') in_string = false;
+    } else if (c == '"') {
+      in_string = true;
+    } else if (c == '{') {
+      if (depth++ == 0) start = i;
+    } else if (c == '}') {
+      if (--depth == 0) f.location_len[f.locations++] = i + 1 - start;
+    }
+  }
+}
+
+static void load_kind(const char *kind) {
+  char dir_path[64];
+  snprintf(dir_path, sizeof(dir_path), FIXTURES_DIR "/%s", kind);
+  DIR *dir = opendir(dir_path);
+  if (!dir) return;
+  while (struct dirent *entry = readdir(dir)) {
+    size_t name_len = strlen(entry->d_name);
+    if (name_len < 6 || strcmp(entry->d_name + name_len - 5, ".json") || fixture_count == MAX_FIXTURES) continue;
+    Fixture &f = fixtures[fixture_count];
+    snprintf(f.kind, sizeof(f.kind), "%s", kind);
+    snprintf(f.key, sizeof(f.key), "%.*s", (int)(name_len - 5), entry->d_name);
+
+    char path[160];
+    snprintf(path, sizeof(path), "%s/%s", dir_path, entry->d_name);
+    FILE *file = fopen(path, "rb");
+    if (!file) continue;
+    fseek(file, 0, SEEK_END);
+    f.len = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    f.body = (char *)malloc(f.len + 1);
+    f.len = fread(f.body, 1, f.len, file);
+    f.body[f.len] = '\0';
+    fclose(file);
+    if (!strcmp(kind, "forecast")) split_locations(f);
+    fixture_count++;
+  }
+  closedir(dir);
+}
+
+// The recording for key, else the first (by name) of the kind that accept() allows
+static const Fixture *find_fixture(const char *kind, const char *key, bool (*accept)(const Fixture &, const char *)) {
+  const Fixture *found = nullptr;
+  for (int i = 0; i < fixture_count; i++) {
+    const Fixture &f = fixtures[i];
+    if (strcmp(f.kind, kind)) continue;
+    if (!strcmp(f.key, key)) return &f;
+    if (accept(f, key) && (!found || strcmp(f.key, found->key) < 0)) found = &f;
+  }
+  return found;
+}
+
+static bool any_recording(const Fixture &, const char *) { return true; }
+
+static bool same_units(const Fixture &f, const char *key) {
+  size_t f_len = strlen(f.key), key_len = strlen(key);
+  bool f_fahrenheit = f_len > 11 && !strcmp(f.key + f_len - 11, "-fahrenheit");
+  bool key_fahrenheit = key_len > 11 && !strcmp(key + key_len - 11, "-fahrenheit");
+  return f_fahrenheit == key_fahrenheit;
+}
+
+// Body bytes of the forecast fault_server.py would send: count locations,
+// taken in turn from the recording, as an array when there are several
+static uint32_t forecast_bytes(int count, bool fahrenheit) {
+  char key[32];
+  snprintf(key, sizeof(key), "%d-locations%s", count, fahrenheit ? "-fahrenheit" : "");
+  const Fixture *f = find_fixture("forecast", key, same_units);
+  if (!f || !f->locations) return 0;
+  if (!strcmp(f->key, key)) return f->len;
+  if (count == 1) return f->location_len[0];
+  uint32_t bytes = 2 + (count - 1);  // Brackets and commas
+  for (int i = 0; i < count; i++) bytes += f->location_len[i % f->locations];
+  return bytes;
+}
+
+static uint32_t fixture_bytes(const char *kind, const char *key) {
+  const Fixture *f = find_fixture(kind, key, any_recording);
+  return f ? f->len : 0;
+}
+
+// ---- The device ----
+
+struct Device {
+  const Scenario *s;
+  int current_panel;
+  bool sliding;
+  uint32_t slide_end;
+  Interval weather;
+  Interval transit;
+  Interval location_rotate;
+  Interval auto_rotate;
+  char geo_cache[GEO_CACHE_ENTRIES][32];
+  int geo_cache_next;
+  uint32_t searches_done;
+};
+
+static void fetch(const char *url, uint32_t bytes_in) {
+  traffic_record(url, traffic_request_bytes(url), bytes_in, bytes_in > 0);
+}
+
+// fetch_and_update_weather()
+static void fetch_weather(const Device &d) {
+  StackStr<512> url;
+  url.add(FORECAST_URL "?latitude=");
+  for (int i = 0; i < d.s->locations; i++) {
+    if (i) url.add(',');
+    url.add(latitudes[i]);
+  }
+  url.add("&longitude=");
+  for (int i = 0; i < d.s->locations; i++) {
+    if (i) url.add(',');
+    url.add(longitudes[i]);
+  }
+  url.add("&current=temperature_2m,apparent_temperature,is_day,weather_code")
+     .add("&daily=temperature_2m_min,temperature_2m_max,weather_code,sunrise,sunset")
+     .add("&hourly=temperature_2m,precipitation_probability,precipitation,is_day,weather_code")
+     .add("&forecast_days=7")
+     .add("&forecast_hours=7")
+     .add("&timeformat=unixtime")
+     .add(d.s->fahrenheit ? "&temperature_unit=fahrenheit&precipitation_unit=inch" : "")
+     .add("&timezone=auto");
+  fetch(url.c_str(), forecast_bytes(d.s->locations, d.s->fahrenheit));
+}
+
+// fetch_tfl_arrivals(): every bus stop, then the tube station
+static void fetch_transit(const Device &d) {
+  for (int i = 0; i < d.s->bus_stops; i++) {
+    StackStr<96> url;
+    url.add(TFL_STOP_URL).add(bus_stop_ids[i]).add("/Arrivals");
+    fetch(url.c_str(), fixture_bytes("arrivals", bus_stop_ids[i]));
+  }
+  if (d.s->tube) {
+    StackStr<96> url;
+    url.add(TFL_STOP_URL).add(tube_station_id).add("/Arrivals");
+    fetch(url.c_str(), fixture_bytes("arrivals", tube_station_id));
+  }
+}
+
+static bool transit_enabled(const Device &d) {
+  return d.s->bus_stops > 0 || d.s->tube;
+}
+
+// show_panel() from rotate_to_next_panel(), with CONFIG_PANEL_SLIDE
+static void rotate_to_next_panel(Device &d, uint32_t now) {
+  if (d.sliding) d.sliding = false;  // finish_panel_slide()
+  d.current_panel = (d.current_panel + 1) % (transit_enabled(d) ? 3 : 2);
+  d.sliding = true;
+  d.slide_end = now + PANEL_SLIDE_TIME;
+}
+
+// run_location_search(q, true) from the keyboard's Enter, in a fresh dialog
+static void search_location(Device &d, const char *q) {
+  const CityRecord *cities[MAX_GEO_RESULTS];
+  if (city_index_search(q, cities, MAX_GEO_RESULTS) > 0) return;
+  for (int i = 0; i < GEO_CACHE_ENTRIES; i++) {
+    if (!strcmp(d.geo_cache[i], q)) return;
+  }
+  snprintf(d.geo_cache[d.geo_cache_next], sizeof(d.geo_cache[0]), "%s", q);
+  d.geo_cache_next = (d.geo_cache_next + 1) % GEO_CACHE_ENTRIES;
+
+  StackStr<160> url;
+  url.add(GEOCODE_URL "?name=").add_urlencoded(q).add("&count=15");
+  char key[32];
+  city_fold(q, key, sizeof(key));
+  fetch(url.c_str(), fixture_bytes("search", key));
+}
+
+static void simulate(const Scenario &s) {
+  Device d = {&s, PANEL_DAILY, false, 0,
+              Interval(UPDATE_INTERVAL, 0), Interval(TRANSIT_REFRESH_INTERVAL, 0),
+              Interval(LOCATION_ROTATE_INTERVAL, 0), Interval(10000, 0), {}, 0, 0};
+  traffic_clear();
+  fetch_weather(d);  // The first fetch at the end of setup()
+
+  for (uint32_t now = SIM_STEP_MS; now <= SIM_DURATION_MS; now += SIM_STEP_MS) {
+    // lv_timer_handler(): the transit timer is created last, so runs first
+    if (transit_enabled(d) && d.transit.due(now) && !d.sliding) fetch_transit(d);
+    if (s.locations > 1) d.location_rotate.due(now);  // Re-renders, no request
+    if (s.auto_rotate && d.auto_rotate.due(now)) rotate_to_next_panel(d, now);
+    if (d.sliding && now >= d.slide_end) {
+      d.sliding = false;
+      if (d.current_panel == PANEL_TRANSIT) fetch_transit(d);
+    }
+
+    if (d.weather.due(now)) fetch_weather(d);
+
+    // Searches spread over the day, each in its own dialog and cache
+    if (d.searches_done < (uint32_t)s.searches &&
+        now >= (d.searches_done + 1) * (SIM_DURATION_MS / (s.searches + 1))) {
+      memset(d.geo_cache, 0, sizeof(d.geo_cache));
+      search_location(d, search_queries[d.searches_done % 4]);
+      d.searches_done++;
+    }
+  }
+
+  char table[1024];
+  traffic_format(table, sizeof(table), SIM_DURATION_MS);
+  printf("%s\n%s\n", s.name, table);
+}
+
+int main() {
+  load_kind("forecast");
+  load_kind("arrivals");
+  load_kind("search");
+  if (!find_fixture("forecast", "", any_recording) || !find_fixture("arrivals", "", any_recording)) {
+    printf("No forecast or arrivals recordings in " FIXTURES_DIR "\n");
+    return 1;
+  }
+  printf("A simulated day in %d ms steps, %d recordings, %u cities in the offline index\n\n",
+         SIM_STEP_MS, fixture_count, city_record_count);
+  for (const Scenario &s : scenarios) simulate(s);
+  return 0;
+}
@@ -0,0 +1,75 @@
+#include <string.h>
+#include "arena.h"
+
+// Every block is preceded by its size, rounded up to ALIGN, so realloc()
+// knows how much to copy
+struct ArenaHeader {
+  uint32_t size;
+  uint32_t pad;
+};
+
+static size_t align_up(size_t n) {
+  return (n + Arena::ALIGN - 1) & ~(Arena::ALIGN - 1);
+}
+
+static ArenaHeader *header_of(void *ptr) {
+  return (ArenaHeader *)ptr - 1;
+}
+
+Arena::Arena(void *buf, size_t size) : size_(size), used_(0), high_water_(0), failures_(0) {
+  // Start on an ALIGN boundary even if buf does not
+  uintptr_t start = ((uintptr_t)buf + ALIGN - 1) & ~(uintptr_t)(ALIGN - 1);
+  size_t skip = start - (uintptr_t)buf;
+  buf_ = (uint8_t *)start;
+  size_ = size > skip ? size - skip : 0;
+}
+
+void *Arena::alloc(size_t size) {
+  size_t need = sizeof(ArenaHeader) + align_up(size);
+  if (size > UINT32_MAX || need > size_ - used_) {
+    failures_++;
+    return nullptr;
+  }
+
+  ArenaHeader *header = (ArenaHeader *)(buf_ + used_);
+  header->size = (uint32_t)size;
+  used_ += need;
+  if (used_ > high_water_) high_water_ = used_;
+  return header + 1;
+}
+
+void *Arena::realloc(void *ptr, size_t size) {
+  if (!ptr) return alloc(size);
+  ArenaHeader *header = header_of(ptr);
+  size_t old_size = header->size;
+
+  // The latest block can simply be resized where it is
+  uint8_t *end = (uint8_t *)ptr + align_up(old_size);
+  if (end == buf_ + used_) {
+    size_t start = (uint8_t *)ptr - buf_;
+    if (size <= UINT32_MAX && align_up(size) <= size_ - start) {
+      header->size = (uint32_t)size;
+      used_ = start + align_up(size);
+      if (used_ > high_water_) high_water_ = used_;
+      return ptr;
+    }
+    failures_++;
+    return nullptr;
+  }
+
+  if (size <= old_size) {
+    header->size = (uint32_t)size;
+    return ptr;
+  }
+  void *moved = alloc(size);
+  if (moved) memcpy(moved, ptr, old_size);
+  return moved;
+}
+
+void Arena::free(void *ptr) {
+  if (!ptr) return;
+  ArenaHeader *header = header_of(ptr);
+  if ((uint8_t *)ptr + align_up(header->size) == buf_ + used_) {
+    used_ = (uint8_t *)header - buf_;
+  }
+}
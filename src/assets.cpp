@@ -0,0 +1,93 @@
+#include <string.h>
+#include "assets.h"
+
+#ifdef ESP_PLATFORM
+#include "esp_idf_version.h"
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#endif
+
+static lv_image_dsc_t asset_dscs[ASSET_COUNT];
+static bool assets_bound = false;
+
+// Same as zlib's crc32(), which the packer uses
+static uint32_t asset_crc32(const uint8_t *data, size_t len) {
+#ifdef ESP_PLATFORM
+  return esp_rom_crc32_le(0, data, len);
+#else
+  uint32_t crc = 0xFFFFFFFFU;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ (0xEDB88320U & (0U - (crc & 1)));
+  }
+  return ~crc;
+#endif
+}
+
+bool assets_bind(const uint8_t *blob, size_t size) {
+  assets_bound = false;
+
+  AssetHeader header;
+  if (!blob || size < sizeof(header)) return false;
+  memcpy(&header, blob, sizeof(header));
+  if (header.magic != ASSET_MAGIC || header.version != ASSET_VERSION) return false;
+  if (header.count != ASSET_COUNT || header.table_hash != ASSET_TABLE_HASH) return false;
+  if (header.size > size || header.size < sizeof(header) + ASSET_COUNT * sizeof(AssetEntry)) return false;
+  if (asset_crc32(blob + sizeof(header), header.size - sizeof(header)) != header.crc32) return false;
+
+  for (int i = 0; i < ASSET_COUNT; i++) {
+    AssetEntry entry;
+    memcpy(&entry, blob + sizeof(header) + i * sizeof(AssetEntry), sizeof(entry));
+    if (entry.offset > header.size || entry.size > header.size - entry.offset) return false;
+    // LVGL reads whole rows as 16-bit pixels straight from flash, then the
+    // RGB565A8 alpha plane at half the stride
+    uint32_t needed = (uint32_t)entry.stride * entry.h;
+    if (entry.cf == LV_COLOR_FORMAT_RGB565A8) needed += needed / 2;
+    if (entry.offset % 4 || needed > entry.size) return false;
+
+    lv_image_dsc_t &dsc = asset_dscs[i];
+    memset(&dsc, 0, sizeof(dsc));
+    dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+    dsc.header.cf = entry.cf;
+    dsc.header.w = entry.w;
+    dsc.header.h = entry.h;
+    dsc.header.stride = entry.stride;
+    dsc.data_size = entry.size;
+    dsc.data = blob + entry.offset;
+  }
+
+  assets_bound = true;
+  return true;
+}
+
+bool assets_init() {
+#ifdef ESP_PLATFORM
+  const esp_partition_t *part = esp_partition_find_first(
+      ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)ASSET_PARTITION_SUBTYPE, ASSET_PARTITION_LABEL);
+  if (!part) return false;
+
+  AssetHeader header;
+  if (esp_partition_read(part, 0, &header, sizeof(header)) != ESP_OK) return false;
+  if (header.magic != ASSET_MAGIC || header.size > part->size) return false;
+
+  // The mapping stays for as long as the app runs
+  const void *blob;
+#if ESP_IDF_VERSION_MAJOR >= 5
+  esp_partition_mmap_handle_t handle;
+  if (esp_partition_mmap(part, 0, header.size, ESP_PARTITION_MMAP_DATA, &blob, &handle) != ESP_OK) return false;
+  if (assets_bind((const uint8_t *)blob, header.size)) return true;
+  esp_partition_munmap(handle);
+#else
+  spi_flash_mmap_handle_t handle;
+  if (esp_partition_mmap(part, 0, header.size, SPI_FLASH_MMAP_DATA, &blob, &handle) != ESP_OK) return false;
+  if (assets_bind((const uint8_t *)blob, header.size)) return true;
+  spi_flash_munmap(handle);
+#endif
+#endif
+  return false;
+}
+
+const lv_img_dsc_t *asset_image(AssetId id) {
+  if (!assets_bound || id < 0 || id >= ASSET_COUNT) return nullptr;
+  return &asset_dscs[id];
+}
@@ -0,0 +1,88 @@
+#include <string.h>
+#include "city_index.h"
+
+size_t city_fold(const char *text, char *key, size_t key_size) {
+  size_t len = 0;
+  const unsigned char *p = (const unsigned char *)text;
+
+  while (*p && len + 1 < key_size) {
+    unsigned char c = *p;
+    if (c < 0x80) {
+      key[len++] = (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+      p++;
+      continue;
+    }
+
+    // Two-byte sequences in the fold range map to a base letter
+    if ((c & 0xE0) == 0xC0 && (p[1] & 0xC0) == 0x80) {
+      unsigned cp = ((c & 0x1F) << 6) | (p[1] & 0x3F);
+      if (cp >= CITY_FOLD_FIRST && cp <= CITY_FOLD_LAST && city_fold_latin[cp - CITY_FOLD_FIRST]) {
+        key[len++] = city_fold_latin[cp - CITY_FOLD_FIRST];
+        p += 2;
+        continue;
+      }
+    }
+
+    // Anything else is kept byte for byte
+    key[len++] = c;
+    p++;
+  }
+
+  key[len] = '\0';
+  return len;
+}
+
+const char *city_name(const CityRecord *city) {
+  return city_string_pool + city->name_ofs;
+}
+
+const char *city_admin1(const CityRecord *city) {
+  if (city->admin1 == CITY_NO_ADMIN1) return nullptr;
+  return city_string_pool + city_admin1_ofs[city->admin1];
+}
+
+static int compare_key(const CityRecord *city, const char *key) {
+  char name_key[CITY_KEY_MAX + 1];
+  city_fold(city_name(city), name_key, sizeof(name_key));
+  return strcmp(name_key, key);
+}
+
+static bool has_prefix(const CityRecord *city, const char *key, size_t key_len) {
+  char name_key[CITY_KEY_MAX + 1];
+  city_fold(city_name(city), name_key, sizeof(name_key));
+  return strncmp(name_key, key, key_len) == 0;
+}
+
+size_t city_index_search(const char *prefix, const CityRecord **out, size_t max_out) {
+  char key[CITY_KEY_MAX + 1];
+  size_t key_len = city_fold(prefix, key, sizeof(key));
+  if (key_len == 0 || max_out == 0) return 0;
+
+  // Lower bound: first record whose key is >= the prefix
+  uint32_t lo = 0;
+  uint32_t hi = city_record_count;
+  while (lo < hi) {
+    uint32_t mid = lo + (hi - lo) / 2;
+    if (compare_key(&city_records[mid], key) < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  // All matches are contiguous; keep the most populous, best first
+  size_t count = 0;
+  for (uint32_t i = lo; i < city_record_count && has_prefix(&city_records[i], key, key_len); i++) {
+    const CityRecord *city = &city_records[i];
+    if (count == max_out && city->population_k <= out[count - 1]->population_k) continue;
+
+    size_t pos = (count < max_out) ? count++ : count - 1;
+    while (pos > 0 && out[pos - 1]->population_k < city->population_k) {
+      out[pos] = out[pos - 1];
+      pos--;
+    }
+    out[pos] = city;
+  }
+
+  return count;
+}
@@ -0,0 +1,106 @@
+#include <string.h>
+#include "forecast_table.h"
+
+// Columns, relative to the content area
+#define LABEL_X 2
+#define ICON_X 72
+#define TEXT_COLUMN_WIDTH 80
+
+// Copy src into a fixed field; returns true if the field changed
+static bool update_field(char *field, size_t size, const char *src) {
+  if (strncmp(field, src, size - 1) == 0) return false;
+  strncpy(field, src, size - 1);
+  field[size - 1] = '\0';
+  return true;
+}
+
+static void row_area(lv_obj_t *obj, int row, lv_area_t *area) {
+  lv_obj_get_content_coords(obj, area);
+  area->y1 += row * FORECAST_TABLE_ROW_HEIGHT;
+  area->y2 = area->y1 + FORECAST_TABLE_ROW_HEIGHT - 1;
+}
+
+static void forecast_table_draw_cb(lv_event_t *e) {
+  lv_obj_t *obj = (lv_obj_t *)lv_event_get_current_target(e);
+  const ForecastTable *table = (const ForecastTable *)lv_event_get_user_data(e);
+  lv_layer_t *layer = lv_event_get_layer(e);
+
+  lv_draw_label_dsc_t primary;
+  lv_draw_label_dsc_init(&primary);
+  lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &primary);
+
+  lv_draw_label_dsc_t label = primary;
+  primary.align = LV_TEXT_ALIGN_RIGHT;
+
+  lv_draw_label_dsc_t secondary;
+  lv_draw_label_dsc_init(&secondary);
+  lv_obj_init_draw_label_dsc(obj, LV_PART_ITEMS, &secondary);
+  secondary.align = LV_TEXT_ALIGN_RIGHT;
+
+  lv_draw_image_dsc_t icon;
+  lv_draw_image_dsc_init(&icon);
+
+  for (int i = 0; i < FORECAST_TABLE_ROWS; i++) {
+    lv_area_t row;
+    row_area(obj, i, &row);
+    // No public getter for the clip area in LVGL 9.2, see screen_background_draw_cb()
+    if (row.y2 < layer->_clip_area.y1 || row.y1 > layer->_clip_area.y2) continue;
+
+    const ForecastRow &r = table->rows[i];
+    lv_area_t area;
+
+    if (r.label[0]) {
+      area = {row.x1 + LABEL_X, row.y1, row.x1 + ICON_X - 1, row.y2};
+      label.text = r.label;
+      lv_draw_label(layer, &label, &area);
+    }
+
+    if (r.icon) {
+      area = {row.x1 + ICON_X, row.y1, row.x1 + ICON_X + (int32_t)r.icon->header.w - 1,
+              row.y1 + (int32_t)r.icon->header.h - 1};
+      icon.src = r.icon;
+      lv_draw_image(layer, &icon, &area);
+    }
+
+    if (r.secondary[0]) {
+      int32_t right = row.x2 - table->secondary_right;
+      area = {right - TEXT_COLUMN_WIDTH + 1, row.y1, right, row.y2};
+      secondary.text = r.secondary;
+      lv_draw_label(layer, &secondary, &area);
+    }
+
+    if (r.primary[0]) {
+      area = {row.x2 - TEXT_COLUMN_WIDTH + 1, row.y1, row.x2, row.y2};
+      primary.text = r.primary;
+      lv_draw_label(layer, &primary, &area);
+    }
+  }
+}
+
+void forecast_table_attach(lv_obj_t *obj, ForecastTable *table, int32_t secondary_right) {
+  memset(table->rows, 0, sizeof(table->rows));
+  table->secondary_right = secondary_right;
+  lv_obj_add_event_cb(obj, forecast_table_draw_cb, LV_EVENT_DRAW_MAIN, table);
+  lv_obj_set_user_data(obj, table);
+}
+
+void forecast_table_set_row(lv_obj_t *obj, int row, const char *label, const lv_img_dsc_t *icon,
+                            const char *secondary, const char *primary) {
+  ForecastTable *table = (ForecastTable *)lv_obj_get_user_data(obj);
+  if (!table || row < 0 || row >= FORECAST_TABLE_ROWS) return;
+
+  ForecastRow &r = table->rows[row];
+  bool changed = update_field(r.label, sizeof(r.label), label);
+  changed |= update_field(r.secondary, sizeof(r.secondary), secondary);
+  changed |= update_field(r.primary, sizeof(r.primary), primary);
+  if (r.icon != icon) {
+    r.icon = icon;
+    changed = true;
+  }
+
+  if (changed) {
+    lv_area_t area;
+    row_area(obj, row, &area);
+    lv_obj_invalidate_area(obj, &area);
+  }
+}
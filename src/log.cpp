@@ -0,0 +1,140 @@
+#include <atomic>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include "log.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+#define LOG_TASK_STACK 3072
+#define LOG_IDLE_WAIT_MS 50
+
+// Bounded multi-producer queue: each slot's sequence number says whether it
+// is free for the writer at that position or holds a line for the reader, so
+// writers only ever race on one compare-and-swap of the head. Sequence
+// numbers are stored relative to the slot index so the zeroed ring is
+// already initialised.
+struct LogSlot {
+  std::atomic<uint32_t> seq;  // Minus the slot index
+  uint8_t level;
+  uint16_t len;
+  char text[LOG_LINE_MAX];
+};
+
+static LogSlot log_slots[LOG_SLOT_COUNT];
+static std::atomic<uint32_t> log_head(0);
+static std::atomic<uint32_t> log_tail(0);  // Only the drain task advances it
+static std::atomic<uint32_t> log_lost(0);
+
+#ifdef ARDUINO
+static TaskHandle_t log_task = nullptr;
+static std::atomic<bool> log_busy(false);  // Drain task is writing lines out
+#endif
+
+static uint32_t slot_seq(uint32_t pos) {
+  return log_slots[pos % LOG_SLOT_COUNT].seq.load(std::memory_order_acquire) + pos % LOG_SLOT_COUNT;
+}
+
+static void set_slot_seq(uint32_t pos, uint32_t seq) {
+  log_slots[pos % LOG_SLOT_COUNT].seq.store(seq - pos % LOG_SLOT_COUNT, std::memory_order_release);
+}
+
+void log_write(int level, const char *fmt, ...) {
+  uint32_t pos = log_head.load(std::memory_order_relaxed);
+  LogSlot *slot;
+  for (;;) {
+    slot = &log_slots[pos % LOG_SLOT_COUNT];
+    int32_t diff = (int32_t)(slot_seq(pos) - pos);
+    if (diff == 0) {
+      if (log_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+    } else if (diff < 0) {
+      log_lost.fetch_add(1, std::memory_order_relaxed);  // Full
+      return;
+    } else {
+      pos = log_head.load(std::memory_order_relaxed);
+    }
+  }
+
+  va_list args;
+  va_start(args, fmt);
+  int len = vsnprintf(slot->text, sizeof(slot->text), fmt, args);
+  va_end(args);
+  if (len < 0) len = 0;
+  if (len >= (int)sizeof(slot->text)) len = sizeof(slot->text) - 1;
+  slot->len = (uint16_t)len;
+  slot->level = (uint8_t)level;
+  set_slot_seq(pos, pos + 1);
+
+#ifdef ARDUINO
+  if (log_task) xTaskNotifyGive(log_task);
+#endif
+}
+
+size_t log_pop(char *out, size_t size, int *level) {
+  uint32_t tail = log_tail.load(std::memory_order_relaxed);
+  if (size == 0 || slot_seq(tail) != tail + 1) return 0;
+
+  const LogSlot *slot = &log_slots[tail % LOG_SLOT_COUNT];
+  size_t len = slot->len < size - 1 ? slot->len : size - 1;
+  memcpy(out, slot->text, len);
+  out[len] = '\0';
+  if (level) *level = slot->level;
+  set_slot_seq(tail, tail + LOG_SLOT_COUNT);
+  log_tail.store(tail + 1, std::memory_order_relaxed);
+  return len;
+}
+
+uint32_t log_dropped() {
+  return log_lost.load(std::memory_order_relaxed);
+}
+
+#ifdef ARDUINO
+static void log_task_fn(void *) {
+  static const char *const prefixes[] = {"", "[E] ", "[W] ", "", "[D] "};
+  static char line[LOG_LINE_MAX];
+  uint32_t reported_lost = 0;
+
+  for (;;) {
+    int level;
+    size_t len;
+    log_busy.store(true);
+    while ((len = log_pop(line, sizeof(line), &level)) > 0) {
+      if (level > LOG_LEVEL_NONE && level <= LOG_LEVEL_DEBUG) Serial.print(prefixes[level]);
+      Serial.write((const uint8_t *)line, len);
+      Serial.write('\n');
+    }
+
+    uint32_t lost = log_dropped();
+    if (lost != reported_lost) {
+      Serial.printf("[W] %lu log lines dropped\n", (unsigned long)(lost - reported_lost));
+      reported_lost = lost;
+    }
+    log_busy.store(false);
+
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(LOG_IDLE_WAIT_MS));
+  }
+}
+#endif
+
+void log_init() {
+#ifdef ARDUINO
+  if (!log_task) xTaskCreate(log_task_fn, "log", LOG_TASK_STACK, nullptr, tskIDLE_PRIORITY + 1, &log_task);
+#endif
+}
+
+void log_flush(uint32_t timeout_ms) {
+#ifdef ARDUINO
+  if (!log_task) return;
+  uint32_t start = millis();
+  while (millis() - start < timeout_ms) {
+    if (log_head.load() == log_tail.load() && !log_busy.load()) break;
+    xTaskNotifyGive(log_task);
+    delay(5);
+  }
+  Serial.flush();
+#else
+  (void)timeout_ms;
+#endif
+}
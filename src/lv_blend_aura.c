@@ -0,0 +1,237 @@
+#include <string.h>
+#include "lv_blend_aura.h"
+
+// Blending runs for every pixel LVGL draws, so keep it out of flash
+#ifdef ESP_PLATFORM
+#include "esp_attr.h"
+#define BLEND_ATTR IRAM_ATTR
+#else
+#define BLEND_ATTR
+#endif
+
+// One RGB565 pixel spread as 00000GGGGGG00000RRRRR000000BBBBB so all three
+// channels can be scaled by a single multiply
+#define SPREAD(c) ((((uint32_t)(c)) | ((uint32_t)(c) << 16)) & 0x07E0F81FU)
+#define FOLD(r) ((uint16_t)(((r) >> 16) | (r)))
+
+// Pixel pairs alias the uint16_t buffers LVGL hands over
+typedef uint32_t __attribute__((may_alias)) pair_t;
+
+#define NEXT_ROW(p, stride) ((void *)((uint8_t *)(p) + (stride)))
+#define NEXT_CONST_ROW(p, stride) ((const void *)((const uint8_t *)(p) + (stride)))
+
+// Same result as lv_color_16_16_mix(fg, bg, mix)
+static inline uint16_t mix565(uint16_t fg, uint16_t bg, uint8_t mix) {
+  if (mix == 255) return fg;
+  if (mix == 0) return bg;
+  if (fg == bg) return fg;
+  uint32_t m = ((uint32_t)mix + 4) >> 3;
+  uint32_t b = SPREAD(bg);
+  uint32_t r = ((((SPREAD(fg) - b) * m) >> 5) + b) & 0x07E0F81FU;
+  return FOLD(r);
+}
+
+// Four mask bytes at once. Masks have no alignment, so no word load.
+static inline uint32_t mask4(const uint8_t *m) {
+  return (uint32_t)m[0] | ((uint32_t)m[1] << 8) | ((uint32_t)m[2] << 16) | ((uint32_t)m[3] << 24);
+}
+
+// Pixels are stored little-endian, so the first pixel of a pair is the low half
+static inline uint32_t pair(uint16_t first, uint16_t second) {
+  return (uint32_t)first | ((uint32_t)second << 16);
+}
+
+void BLEND_ATTR aura_fill_rgb565(uint16_t *dest, int32_t w, int32_t h, int32_t dest_stride, uint16_t color) {
+  uint32_t c32 = pair(color, color);
+
+  for (int32_t y = 0; y < h; y++) {
+    uint16_t *d = dest;
+    int32_t x = 0;
+    if (((uintptr_t)d & 2) && w > 0) {
+      *d++ = color;
+      x = 1;
+    }
+
+    pair_t *d32 = (pair_t *)d;
+    for (; x + 8 <= w; x += 8) {
+      d32[0] = c32;
+      d32[1] = c32;
+      d32[2] = c32;
+      d32[3] = c32;
+      d32 += 4;
+    }
+    for (; x + 2 <= w; x += 2) *d32++ = c32;
+    if (x < w) *(uint16_t *)d32 = color;
+
+    dest = (uint16_t *)NEXT_ROW(dest, dest_stride);
+  }
+}
+
+void BLEND_ATTR aura_fill_rgb565_opa(uint16_t *dest, int32_t w, int32_t h, int32_t dest_stride,
+                                     uint16_t color, uint8_t opa) {
+  // Backgrounds are mostly uniform, so remember the last pair mixed
+  uint32_t last_in = pair(0, 0);
+  uint32_t last_out = pair(mix565(color, 0, opa), mix565(color, 0, opa));
+
+  for (int32_t y = 0; y < h; y++) {
+    uint16_t *d = dest;
+    int32_t x = 0;
+    if (((uintptr_t)d & 2) && w > 0) {
+      *d = mix565(color, *d, opa);
+      d++;
+      x = 1;
+    }
+
+    pair_t *d32 = (pair_t *)d;
+    for (; x + 2 <= w; x += 2, d32++) {
+      uint32_t v = *d32;
+      if (v != last_in) {
+        last_in = v;
+        last_out = pair(mix565(color, (uint16_t)v, opa), mix565(color, (uint16_t)(v >> 16), opa));
+      }
+      *d32 = last_out;
+    }
+    if (x < w) {
+      d = (uint16_t *)d32;
+      *d = mix565(color, *d, opa);
+    }
+
+    dest = (uint16_t *)NEXT_ROW(dest, dest_stride);
+  }
+}
+
+void BLEND_ATTR aura_fill_rgb565_mask(uint16_t *dest, int32_t w, int32_t h, int32_t dest_stride,
+                                      uint16_t color, const uint8_t *mask, int32_t mask_stride) {
+  uint32_t c32 = pair(color, color);
+
+  for (int32_t y = 0; y < h; y++) {
+    uint16_t *d = dest;
+    const uint8_t *m = mask;
+    int32_t x = 0;
+    if (((uintptr_t)d & 2) && w > 0) {
+      *d = mix565(color, *d, *m++);
+      d++;
+      x = 1;
+    }
+
+    // Glyph masks are mostly runs of fully transparent or fully opaque
+    // pixels; only the edges between them are mixed
+    pair_t *d32 = (pair_t *)d;
+    for (; x + 4 <= w; x += 4, d32 += 2, m += 4) {
+      uint32_t m4 = mask4(m);
+      if (m4 == 0xFFFFFFFFU) {
+        d32[0] = c32;
+        d32[1] = c32;
+      } else if (m4) {
+        uint16_t *d16 = (uint16_t *)d32;
+        for (int k = 0; k < 4; k++) d16[k] = mix565(color, d16[k], m[k]);
+      }
+    }
+    for (; x + 2 <= w; x += 2, d32++, m += 2) {
+      uint8_t m0 = m[0];
+      uint8_t m1 = m[1];
+      if ((m0 & m1) == 0xFF) {
+        *d32 = c32;
+      } else if (m0 | m1) {
+        uint32_t v = *d32;
+        *d32 = pair(mix565(color, (uint16_t)v, m0), mix565(color, (uint16_t)(v >> 16), m1));
+      }
+    }
+    if (x < w) {
+      d = (uint16_t *)d32;
+      *d = mix565(color, *d, *m);
+    }
+
+    dest = (uint16_t *)NEXT_ROW(dest, dest_stride);
+    mask = (const uint8_t *)NEXT_CONST_ROW(mask, mask_stride);
+  }
+}
+
+void BLEND_ATTR aura_blit_rgb565(uint16_t *dest, int32_t w, int32_t h, int32_t dest_stride,
+                                 const uint16_t *src, int32_t src_stride) {
+  size_t row_bytes = (size_t)w * 2;
+  if (dest_stride == src_stride && (size_t)dest_stride == row_bytes) {
+    memcpy(dest, src, row_bytes * h);
+    return;
+  }
+
+  for (int32_t y = 0; y < h; y++) {
+    memcpy(dest, src, row_bytes);
+    dest = (uint16_t *)NEXT_ROW(dest, dest_stride);
+    src = (const uint16_t *)NEXT_CONST_ROW(src, src_stride);
+  }
+}
+
+void BLEND_ATTR aura_blit_rgb565_mask(uint16_t *dest, int32_t w, int32_t h, int32_t dest_stride,
+                                      const uint16_t *src, int32_t src_stride,
+                                      const uint8_t *mask, int32_t mask_stride) {
+  for (int32_t y = 0; y < h; y++) {
+    uint16_t *d = dest;
+    const uint16_t *s = src;
+    const uint8_t *m = mask;
+    int32_t x = 0;
+    if (((uintptr_t)d & 2) && w > 0) {
+      *d = mix565(*s++, *d, *m++);
+      d++;
+      x = 1;
+    }
+
+    pair_t *d32 = (pair_t *)d;
+    if (((uintptr_t)s & 2) == 0) {
+      // Source and destination both word aligned: whole pairs at a time
+      const pair_t *s32 = (const pair_t *)s;
+      for (; x + 4 <= w; x += 4, d32 += 2, s32 += 2, m += 4) {
+        uint32_t m4 = mask4(m);
+        if (m4 == 0xFFFFFFFFU) {
+          d32[0] = s32[0];
+          d32[1] = s32[1];
+        } else if (m4) {
+          uint16_t *d16 = (uint16_t *)d32;
+          const uint16_t *s16 = (const uint16_t *)s32;
+          for (int k = 0; k < 4; k++) d16[k] = mix565(s16[k], d16[k], m[k]);
+        }
+      }
+      for (; x + 2 <= w; x += 2, d32++, s32++, m += 2) {
+        uint8_t m0 = m[0];
+        uint8_t m1 = m[1];
+        if ((m0 & m1) == 0xFF) {
+          *d32 = *s32;
+        } else if (m0 | m1) {
+          uint32_t v = *d32;
+          uint32_t sv = *s32;
+          *d32 = pair(mix565((uint16_t)sv, (uint16_t)v, m0), mix565((uint16_t)(sv >> 16), (uint16_t)(v >> 16), m1));
+        }
+      }
+      s = (const uint16_t *)s32;
+    } else {
+      for (; x + 4 <= w; x += 4, d32 += 2, s += 4, m += 4) {
+        uint32_t m4 = mask4(m);
+        if (m4 == 0xFFFFFFFFU) {
+          d32[0] = pair(s[0], s[1]);
+          d32[1] = pair(s[2], s[3]);
+        } else if (m4) {
+          uint16_t *d16 = (uint16_t *)d32;
+          for (int k = 0; k < 4; k++) d16[k] = mix565(s[k], d16[k], m[k]);
+        }
+      }
+      for (; x + 2 <= w; x += 2, d32++, s += 2, m += 2) {
+        uint8_t m0 = m[0];
+        uint8_t m1 = m[1];
+        if ((m0 & m1) == 0xFF) {
+          *d32 = pair(s[0], s[1]);
+        } else if (m0 | m1) {
+          uint32_t v = *d32;
+          *d32 = pair(mix565(s[0], (uint16_t)v, m0), mix565(s[1], (uint16_t)(v >> 16), m1));
+        }
+      }
+    }
+    if (x < w) {
+      d = (uint16_t *)d32;
+      *d = mix565(*s, *d, *m);
+    }
+
+    dest = (uint16_t *)NEXT_ROW(dest, dest_stride);
+    src = (const uint16_t *)NEXT_CONST_ROW(src, src_stride);
+    mask = (const uint8_t *)NEXT_CONST_ROW(mask, mask_stride);
+  }
+}
@@ -1,574 +0,0 @@
-/*******************************************************************************
- * Size: 20 px
- * Bpp: 4
- * Opts: --bpp 4 --size 20 --no-compress --stride 1 --align 1 --font Montserrat-Light.ttf --symbols °¿ÉÊÍÓÜßáäçèéíñóöúûü‐→Îàâéèêëîïôöùûüÿç --format lvgl -o lv_font_montserrat_latin_20.c
- ******************************************************************************/
-
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef LV_FONT_MONTSERRAT_LATIN_20
-#define LV_FONT_MONTSERRAT_LATIN_20 1
-#endif
-
-#if LV_FONT_MONTSERRAT_LATIN_20
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+00B0 "°" */
-    0x5, 0xcb, 0x20, 0x2b, 0x2, 0xc0, 0x66, 0x0,
-    0xa2, 0x2b, 0x1, 0xc0, 0x5, 0xcb, 0x30,
-
-    /* U+00BF "¿" */
-    0x0, 0x3, 0xf4, 0x0, 0x0, 0x0, 0x4f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x50, 0x0, 0x0, 0x0,
-    0x3f, 0x0, 0x0, 0x0, 0xa, 0xb0, 0x0, 0x0,
-    0x8, 0xe2, 0x0, 0x0, 0x6, 0xf2, 0x0, 0x0,
-    0x0, 0xf6, 0x0, 0x0, 0x0, 0x3f, 0x20, 0x0,
-    0x5, 0x14, 0xf4, 0x0, 0x1, 0xf2, 0xe, 0xe5,
-    0x24, 0xcc, 0x0, 0x3d, 0xff, 0xfc, 0x20, 0x0,
-    0x2, 0x42, 0x0, 0x0,
-
-    /* U+00C9 "É" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf7, 0x0, 0x0, 0x0, 0x2e, 0xc1, 0x0, 0x0,
-    0x0, 0x68, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xfa, 0xed, 0x88,
-    0x88, 0x88, 0x85, 0xeb, 0x0, 0x0, 0x0, 0x0,
-    0xeb, 0x0, 0x0, 0x0, 0x0, 0xeb, 0x0, 0x0,
-    0x0, 0x0, 0xeb, 0x0, 0x0, 0x0, 0x0, 0xeb,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xc0, 0xed, 0x88, 0x88, 0x88, 0x60, 0xeb, 0x0,
-    0x0, 0x0, 0x0, 0xeb, 0x0, 0x0, 0x0, 0x0,
-    0xeb, 0x0, 0x0, 0x0, 0x0, 0xeb, 0x0, 0x0,
-    0x0, 0x0, 0xed, 0x88, 0x88, 0x88, 0x87, 0xef,
-    0xff, 0xff, 0xff, 0xfe,
-
-    /* U+00CA "Ê" */
-    0x0, 0x0, 0x77, 0x0, 0x0, 0x0, 0xa, 0xee,
-    0xa0, 0x0, 0x0, 0x7f, 0x32, 0xe8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xfa, 0xed, 0x88, 0x88, 0x88, 0x85, 0xeb, 0x0,
-    0x0, 0x0, 0x0, 0xeb, 0x0, 0x0, 0x0, 0x0,
-    0xeb, 0x0, 0x0, 0x0, 0x0, 0xeb, 0x0, 0x0,
-    0x0, 0x0, 0xeb, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xc0, 0xed, 0x88, 0x88, 0x88,
-    0x60, 0xeb, 0x0, 0x0, 0x0, 0x0, 0xeb, 0x0,
-    0x0, 0x0, 0x0, 0xeb, 0x0, 0x0, 0x0, 0x0,
-    0xeb, 0x0, 0x0, 0x0, 0x0, 0xed, 0x88, 0x88,
-    0x88, 0x87, 0xef, 0xff, 0xff, 0xff, 0xfe,
-
-    /* U+00CD "Í" */
-    0x0, 0x0, 0x0, 0x5, 0xf6, 0x3, 0xfb, 0x0,
-    0x77, 0x0, 0x0, 0x0, 0x0, 0xeb, 0x0, 0xe,
-    0xb0, 0x0, 0xeb, 0x0, 0xe, 0xb0, 0x0, 0xeb,
-    0x0, 0xe, 0xb0, 0x0, 0xeb, 0x0, 0xe, 0xb0,
-    0x0, 0xeb, 0x0, 0xe, 0xb0, 0x0, 0xeb, 0x0,
-    0xe, 0xb0, 0x0, 0xeb, 0x0, 0xe, 0xb0, 0x0,
-    0xeb, 0x0,
-
-    /* U+00CE "Î" */
-    0x1, 0x77, 0x0, 0xb, 0xef, 0x90, 0x9e, 0x23,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xeb, 0x0, 0x0,
-    0xeb, 0x0, 0x0, 0xeb, 0x0, 0x0, 0xeb, 0x0,
-    0x0, 0xeb, 0x0, 0x0, 0xeb, 0x0, 0x0, 0xeb,
-    0x0, 0x0, 0xeb, 0x0, 0x0, 0xeb, 0x0, 0x0,
-    0xeb, 0x0, 0x0, 0xeb, 0x0, 0x0, 0xeb, 0x0,
-    0x0, 0xeb, 0x0, 0x0, 0xeb, 0x0, 0x0, 0xeb,
-    0x0,
-
-    /* U+00D3 "Ó" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xce, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xa1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x17, 0xcf, 0xfd, 0x92, 0x0, 0x0,
-    0x0, 0x4, 0xef, 0xda, 0x9c, 0xff, 0x70, 0x0,
-    0x0, 0x4f, 0xe4, 0x0, 0x0, 0x2b, 0xf8, 0x0,
-    0x1, 0xee, 0x10, 0x0, 0x0, 0x0, 0xbf, 0x40,
-    0x8, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xc0,
-    0xe, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf2,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf5,
-    0x2f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf6,
-    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf5,
-    0xe, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf2,
-    0x8, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xc0,
-    0x1, 0xed, 0x10, 0x0, 0x0, 0x0, 0xaf, 0x40,
-    0x0, 0x4f, 0xd3, 0x0, 0x0, 0x1b, 0xf8, 0x0,
-    0x0, 0x4, 0xef, 0xc9, 0x9b, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x17, 0xce, 0xfd, 0x82, 0x0, 0x0,
-
-    /* U+00DC "Ü" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xc0, 0x6f, 0x20, 0x0, 0x0, 0x0, 0xbb,
-    0x5, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x60, 0x0, 0x0, 0x0, 0x1f,
-    0x73, 0xf6, 0x0, 0x0, 0x0, 0x1, 0xf7, 0x3f,
-    0x60, 0x0, 0x0, 0x0, 0x1f, 0x73, 0xf6, 0x0,
-    0x0, 0x0, 0x1, 0xf7, 0x3f, 0x60, 0x0, 0x0,
-    0x0, 0x1f, 0x73, 0xf6, 0x0, 0x0, 0x0, 0x1,
-    0xf7, 0x3f, 0x60, 0x0, 0x0, 0x0, 0x1f, 0x73,
-    0xf6, 0x0, 0x0, 0x0, 0x1, 0xf7, 0x3f, 0x60,
-    0x0, 0x0, 0x0, 0x1f, 0x72, 0xf7, 0x0, 0x0,
-    0x0, 0x2, 0xf6, 0xf, 0xa0, 0x0, 0x0, 0x0,
-    0x5f, 0x40, 0xcf, 0x10, 0x0, 0x0, 0xb, 0xf1,
-    0x4, 0xfc, 0x10, 0x0, 0x8, 0xf8, 0x0, 0x7,
-    0xff, 0xa8, 0x9d, 0xfb, 0x0, 0x0, 0x3, 0xae,
-    0xfe, 0xc6, 0x0, 0x0,
-
-    /* U+00DF "ß" */
-    0x0, 0x8, 0xdf, 0xea, 0x20, 0x0, 0x1d, 0xf9,
-    0x68, 0xef, 0x30, 0x9, 0xf3, 0x0, 0x1, 0xec,
-    0x0, 0xfa, 0x0, 0x0, 0x8, 0xf0, 0x2f, 0x70,
-    0x0, 0x0, 0x8f, 0x3, 0xf5, 0x0, 0x0, 0xd,
-    0xa0, 0x3f, 0x50, 0x1, 0x4c, 0xd1, 0x3, 0xf5,
-    0x0, 0xbf, 0xe4, 0x0, 0x3f, 0x50, 0x2, 0x59,
-    0xfb, 0x3, 0xf5, 0x0, 0x0, 0x3, 0xf7, 0x3f,
-    0x50, 0x0, 0x0, 0xc, 0xb3, 0xf5, 0x0, 0x0,
-    0x0, 0xdb, 0x3f, 0x50, 0x0, 0x0, 0x4f, 0x73,
-    0xf5, 0x1, 0x56, 0xaf, 0xb0, 0x3f, 0x50, 0x4f,
-    0xec, 0x60, 0x0,
-
-    /* U+00E0 "à" */
-    0x0, 0x25, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x0,
-    0x0, 0x0, 0x8, 0xf3, 0x0, 0x0, 0x0, 0x2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18,
-    0xdf, 0xeb, 0x30, 0x3f, 0xe8, 0x68, 0xef, 0x40,
-    0x70, 0x0, 0x2, 0xfb, 0x0, 0x0, 0x0, 0xb,
-    0xe0, 0x0, 0x0, 0x0, 0x9f, 0x7, 0xdf, 0xff,
-    0xff, 0xf9, 0xf7, 0x43, 0x33, 0xaf, 0xf8, 0x0,
-    0x0, 0xa, 0xfe, 0xa0, 0x0, 0x4, 0xff, 0x7f,
-    0xa6, 0x6a, 0xfc, 0xf0, 0x7d, 0xfe, 0xa2, 0x9f,
-
-    /* U+00E1 "á" */
-    0x0, 0x0, 0x2, 0x50, 0x0, 0x0, 0x1, 0xde,
-    0x30, 0x0, 0x0, 0xcd, 0x20, 0x0, 0x0, 0x2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18,
-    0xdf, 0xeb, 0x30, 0x3f, 0xe8, 0x68, 0xef, 0x40,
-    0x70, 0x0, 0x2, 0xfb, 0x0, 0x0, 0x0, 0xb,
-    0xe0, 0x0, 0x0, 0x0, 0x9f, 0x7, 0xdf, 0xff,
-    0xff, 0xf9, 0xf7, 0x43, 0x33, 0xaf, 0xf8, 0x0,
-    0x0, 0xa, 0xfe, 0xa0, 0x0, 0x4, 0xff, 0x7f,
-    0xa6, 0x6a, 0xfc, 0xf0, 0x7d, 0xfe, 0xa2, 0x9f,
-
-    /* U+00E2 "â" */
-    0x0, 0x9, 0xfd, 0x10, 0x0, 0x7, 0xf5, 0xcc,
-    0x0, 0x0, 0x53, 0x0, 0x52, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x8d, 0xfe, 0xb3, 0x3, 0xfe,
-    0x86, 0x8e, 0xf4, 0x7, 0x0, 0x0, 0x2f, 0xb0,
-    0x0, 0x0, 0x0, 0xbe, 0x0, 0x0, 0x0, 0x9,
-    0xf0, 0x7d, 0xff, 0xff, 0xff, 0x9f, 0x74, 0x33,
-    0x3a, 0xff, 0x80, 0x0, 0x0, 0xaf, 0xea, 0x0,
-    0x0, 0x4f, 0xf7, 0xfa, 0x66, 0xaf, 0xcf, 0x7,
-    0xdf, 0xea, 0x29, 0xf0,
-
-    /* U+00E4 "ä" */
-    0x0, 0xbb, 0x6, 0xe2, 0x0, 0xb, 0xb0, 0x6f,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x8d, 0xfe, 0xb3, 0x3, 0xfe,
-    0x86, 0x8e, 0xf4, 0x7, 0x0, 0x0, 0x2f, 0xb0,
-    0x0, 0x0, 0x0, 0xbe, 0x0, 0x0, 0x0, 0x9,
-    0xf0, 0x7d, 0xff, 0xff, 0xff, 0x9f, 0x74, 0x33,
-    0x3a, 0xff, 0x80, 0x0, 0x0, 0xaf, 0xea, 0x0,
-    0x0, 0x4f, 0xf7, 0xfa, 0x66, 0xaf, 0xcf, 0x7,
-    0xdf, 0xea, 0x29, 0xf0,
-
-    /* U+00E7 "ç" */
-    0x0, 0x5, 0xbe, 0xfd, 0x70, 0x0, 0x9, 0xfd,
-    0x87, 0xaf, 0xd0, 0x5, 0xf9, 0x0, 0x0, 0x25,
-    0x0, 0xcd, 0x0, 0x0, 0x0, 0x0, 0xf, 0x80,
-    0x0, 0x0, 0x0, 0x2, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x70, 0x0, 0x0, 0x0, 0x0, 0xdd,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xf8, 0x0, 0x0,
-    0x28, 0x0, 0xa, 0xfc, 0x87, 0xaf, 0xd1, 0x0,
-    0x6, 0xcf, 0xfd, 0x80, 0x0, 0x0, 0x0, 0xd2,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xd3, 0x0, 0x0,
-    0x0, 0x3, 0x2c, 0x70, 0x0, 0x0, 0x0, 0xcf,
-    0xc1, 0x0, 0x0,
-
-    /* U+00E8 "è" */
-    0x0, 0x1, 0x60, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xce, 0xfc, 0x60, 0x0, 0x0, 0x9f, 0xb7, 0x6a,
-    0xfa, 0x0, 0x5, 0xf7, 0x0, 0x0, 0x6f, 0x40,
-    0xc, 0xc0, 0x0, 0x0, 0xc, 0xa0, 0xf, 0x80,
-    0x0, 0x0, 0x8, 0xe0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0xf, 0x93, 0x33, 0x33, 0x33, 0x30,
-    0xd, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7,
-    0x0, 0x0, 0x7, 0x0, 0x0, 0x9f, 0xc7, 0x68,
-    0xed, 0x10, 0x0, 0x5, 0xce, 0xfd, 0x80, 0x0,
-
-    /* U+00E9 "é" */
-    0x0, 0x0, 0x0, 0x6, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x60, 0x0, 0x0, 0x0, 0x8, 0xe4,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xce, 0xfc, 0x60, 0x0, 0x0, 0x9f, 0xb7, 0x6a,
-    0xfa, 0x0, 0x5, 0xf7, 0x0, 0x0, 0x6f, 0x40,
-    0xc, 0xc0, 0x0, 0x0, 0xc, 0xa0, 0xf, 0x80,
-    0x0, 0x0, 0x8, 0xe0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0xf, 0x93, 0x33, 0x33, 0x33, 0x30,
-    0xd, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf7,
-    0x0, 0x0, 0x7, 0x0, 0x0, 0x9f, 0xc7, 0x68,
-    0xed, 0x10, 0x0, 0x5, 0xce, 0xfd, 0x80, 0x0,
-
-    /* U+00EA "ê" */
-    0x0, 0x0, 0x5f, 0xf3, 0x0, 0x0, 0x0, 0x3,
-    0xf7, 0x9e, 0x20, 0x0, 0x0, 0x4, 0x40, 0x5,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xce, 0xfc, 0x60, 0x0, 0x0, 0x9f,
-    0xb7, 0x6a, 0xfa, 0x0, 0x5, 0xf7, 0x0, 0x0,
-    0x6f, 0x40, 0xc, 0xc0, 0x0, 0x0, 0xc, 0xa0,
-    0xf, 0x80, 0x0, 0x0, 0x8, 0xe0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xf, 0x93, 0x33, 0x33,
-    0x33, 0x30, 0xd, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf7, 0x0, 0x0, 0x7, 0x0, 0x0, 0x9f,
-    0xc7, 0x68, 0xed, 0x10, 0x0, 0x5, 0xce, 0xfd,
-    0x80, 0x0,
-
-    /* U+00EB "ë" */
-    0x0, 0x6, 0xe1, 0x2e, 0x50, 0x0, 0x0, 0x7,
-    0xe1, 0x2f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xce, 0xfc, 0x60, 0x0, 0x0, 0x9f,
-    0xb7, 0x6a, 0xfa, 0x0, 0x5, 0xf7, 0x0, 0x0,
-    0x6f, 0x40, 0xc, 0xc0, 0x0, 0x0, 0xc, 0xa0,
-    0xf, 0x80, 0x0, 0x0, 0x8, 0xe0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xf, 0x93, 0x33, 0x33,
-    0x33, 0x30, 0xd, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf7, 0x0, 0x0, 0x7, 0x0, 0x0, 0x9f,
-    0xc7, 0x68, 0xed, 0x10, 0x0, 0x5, 0xce, 0xfd,
-    0x80, 0x0,
-
-    /* U+00ED "í" */
-    0x0, 0x36, 0x0, 0x1e, 0xe2, 0xd, 0xc1, 0x0,
-    0x10, 0x0, 0x0, 0x0, 0x1, 0xf7, 0x0, 0x1f,
-    0x70, 0x1, 0xf7, 0x0, 0x1f, 0x70, 0x1, 0xf7,
-    0x0, 0x1f, 0x70, 0x1, 0xf7, 0x0, 0x1f, 0x70,
-    0x1, 0xf7, 0x0, 0x1f, 0x70, 0x1, 0xf7, 0x0,
-
-    /* U+00EE "î" */
-    0x0, 0xaf, 0xd1, 0x0, 0x8f, 0x4c, 0xc0, 0x5,
-    0x20, 0x5, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0x70, 0x0, 0x1, 0xf7, 0x0, 0x0, 0x1f, 0x70,
-    0x0, 0x1, 0xf7, 0x0, 0x0, 0x1f, 0x70, 0x0,
-    0x1, 0xf7, 0x0, 0x0, 0x1f, 0x70, 0x0, 0x1,
-    0xf7, 0x0, 0x0, 0x1f, 0x70, 0x0, 0x1, 0xf7,
-    0x0, 0x0, 0x1f, 0x70, 0x0,
-
-    /* U+00EF "ï" */
-    0xbb, 0x6, 0xe2, 0xbb, 0x6, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf7, 0x0, 0x1,
-    0xf7, 0x0, 0x1, 0xf7, 0x0, 0x1, 0xf7, 0x0,
-    0x1, 0xf7, 0x0, 0x1, 0xf7, 0x0, 0x1, 0xf7,
-    0x0, 0x1, 0xf7, 0x0, 0x1, 0xf7, 0x0, 0x1,
-    0xf7, 0x0, 0x1, 0xf7, 0x0,
-
-    /* U+00F1 "ñ" */
-    0x0, 0x8, 0xfb, 0x37, 0xc0, 0x0, 0x0, 0xf7,
-    0x9f, 0xf7, 0x0, 0x0, 0x3, 0x0, 0x12, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x71,
-    0x9e, 0xfe, 0x80, 0x1, 0xf8, 0xdd, 0x99, 0xdf,
-    0xb0, 0x1f, 0xf9, 0x0, 0x0, 0xbf, 0x41, 0xfd,
-    0x0, 0x0, 0x3, 0xf7, 0x1f, 0x90, 0x0, 0x0,
-    0xf, 0x81, 0xf7, 0x0, 0x0, 0x0, 0xf8, 0x1f,
-    0x70, 0x0, 0x0, 0xf, 0x81, 0xf7, 0x0, 0x0,
-    0x0, 0xf8, 0x1f, 0x70, 0x0, 0x0, 0xf, 0x81,
-    0xf7, 0x0, 0x0, 0x0, 0xf8, 0x1f, 0x70, 0x0,
-    0x0, 0xf, 0x80,
-
-    /* U+00F3 "ó" */
-    0x0, 0x0, 0x0, 0x6, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x4, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xbe, 0xfd, 0x70, 0x0, 0x0, 0x9f, 0xd8, 0x7b,
-    0xfd, 0x10, 0x5, 0xf9, 0x0, 0x0, 0x4f, 0xb0,
-    0xc, 0xd0, 0x0, 0x0, 0x8, 0xf2, 0xf, 0x80,
-    0x0, 0x0, 0x2, 0xf6, 0x2f, 0x60, 0x0, 0x0,
-    0x1, 0xf7, 0xf, 0x80, 0x0, 0x0, 0x2, 0xf6,
-    0xc, 0xd0, 0x0, 0x0, 0x8, 0xf2, 0x5, 0xf8,
-    0x0, 0x0, 0x3f, 0xa0, 0x0, 0x8f, 0xc8, 0x7a,
-    0xfd, 0x10, 0x0, 0x4, 0xbe, 0xfd, 0x70, 0x0,
-
-    /* U+00F4 "ô" */
-    0x0, 0x0, 0x2e, 0xf7, 0x0, 0x0, 0x0, 0x1,
-    0xdb, 0x6f, 0x50, 0x0, 0x0, 0x3, 0x50, 0x3,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xbe, 0xfd, 0x70, 0x0, 0x0, 0x9f,
-    0xd8, 0x7b, 0xfd, 0x10, 0x5, 0xf9, 0x0, 0x0,
-    0x4f, 0xb0, 0xc, 0xd0, 0x0, 0x0, 0x8, 0xf2,
-    0xf, 0x80, 0x0, 0x0, 0x2, 0xf6, 0x2f, 0x60,
-    0x0, 0x0, 0x1, 0xf7, 0xf, 0x80, 0x0, 0x0,
-    0x2, 0xf6, 0xc, 0xd0, 0x0, 0x0, 0x8, 0xf2,
-    0x5, 0xf8, 0x0, 0x0, 0x3f, 0xa0, 0x0, 0x8f,
-    0xc8, 0x7a, 0xfd, 0x10, 0x0, 0x4, 0xbe, 0xfd,
-    0x70, 0x0,
-
-    /* U+00F6 "ö" */
-    0x0, 0x3, 0xf4, 0xd, 0x90, 0x0, 0x0, 0x4,
-    0xf4, 0xd, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xbe, 0xfd, 0x70, 0x0, 0x0, 0x9f,
-    0xd8, 0x7b, 0xfd, 0x10, 0x5, 0xf9, 0x0, 0x0,
-    0x4f, 0xb0, 0xc, 0xd0, 0x0, 0x0, 0x8, 0xf2,
-    0xf, 0x80, 0x0, 0x0, 0x2, 0xf6, 0x2f, 0x60,
-    0x0, 0x0, 0x1, 0xf7, 0xf, 0x80, 0x0, 0x0,
-    0x2, 0xf6, 0xc, 0xd0, 0x0, 0x0, 0x8, 0xf2,
-    0x5, 0xf8, 0x0, 0x0, 0x3f, 0xa0, 0x0, 0x8f,
-    0xc8, 0x7a, 0xfd, 0x10, 0x0, 0x4, 0xbe, 0xfd,
-    0x70, 0x0,
-
-    /* U+00F9 "ù" */
-    0x0, 0x5, 0x40, 0x0, 0x0, 0x0, 0x1, 0xcf,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0xae, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf1, 0x0, 0x0, 0x8,
-    0xf0, 0x7f, 0x10, 0x0, 0x0, 0x8f, 0x7, 0xf1,
-    0x0, 0x0, 0x8, 0xf0, 0x7f, 0x10, 0x0, 0x0,
-    0x8f, 0x7, 0xf1, 0x0, 0x0, 0x8, 0xf0, 0x7f,
-    0x10, 0x0, 0x0, 0x8f, 0x7, 0xf1, 0x0, 0x0,
-    0xa, 0xf0, 0x6f, 0x40, 0x0, 0x0, 0xef, 0x2,
-    0xfc, 0x0, 0x0, 0x9e, 0xf0, 0xa, 0xfd, 0x98,
-    0xdd, 0x8f, 0x0, 0x8, 0xef, 0xe9, 0x18, 0xf0,
-
-    /* U+00FA "ú" */
-    0x0, 0x0, 0x0, 0x45, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc1, 0x0, 0x0, 0x0, 0x2e, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf1, 0x0, 0x0, 0x8,
-    0xf0, 0x7f, 0x10, 0x0, 0x0, 0x8f, 0x7, 0xf1,
-    0x0, 0x0, 0x8, 0xf0, 0x7f, 0x10, 0x0, 0x0,
-    0x8f, 0x7, 0xf1, 0x0, 0x0, 0x8, 0xf0, 0x7f,
-    0x10, 0x0, 0x0, 0x8f, 0x7, 0xf1, 0x0, 0x0,
-    0xa, 0xf0, 0x6f, 0x40, 0x0, 0x0, 0xef, 0x2,
-    0xfc, 0x0, 0x0, 0x9e, 0xf0, 0xa, 0xfd, 0x98,
-    0xdd, 0x8f, 0x0, 0x8, 0xef, 0xe9, 0x18, 0xf0,
-
-    /* U+00FB "û" */
-    0x0, 0x0, 0xcf, 0xb0, 0x0, 0x0, 0x0, 0xad,
-    0x4e, 0xa0, 0x0, 0x0, 0x15, 0x10, 0x15, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x10,
-    0x0, 0x0, 0x8f, 0x7, 0xf1, 0x0, 0x0, 0x8,
-    0xf0, 0x7f, 0x10, 0x0, 0x0, 0x8f, 0x7, 0xf1,
-    0x0, 0x0, 0x8, 0xf0, 0x7f, 0x10, 0x0, 0x0,
-    0x8f, 0x7, 0xf1, 0x0, 0x0, 0x8, 0xf0, 0x7f,
-    0x10, 0x0, 0x0, 0xaf, 0x6, 0xf4, 0x0, 0x0,
-    0xe, 0xf0, 0x2f, 0xc0, 0x0, 0x9, 0xef, 0x0,
-    0xaf, 0xd9, 0x8d, 0xd8, 0xf0, 0x0, 0x8e, 0xfe,
-    0x91, 0x8f, 0x0,
-
-    /* U+00FC "ü" */
-    0x0, 0xe, 0x80, 0x9d, 0x0, 0x0, 0x0, 0xe8,
-    0x9, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x10,
-    0x0, 0x0, 0x8f, 0x7, 0xf1, 0x0, 0x0, 0x8,
-    0xf0, 0x7f, 0x10, 0x0, 0x0, 0x8f, 0x7, 0xf1,
-    0x0, 0x0, 0x8, 0xf0, 0x7f, 0x10, 0x0, 0x0,
-    0x8f, 0x7, 0xf1, 0x0, 0x0, 0x8, 0xf0, 0x7f,
-    0x10, 0x0, 0x0, 0xaf, 0x6, 0xf4, 0x0, 0x0,
-    0xe, 0xf0, 0x2f, 0xc0, 0x0, 0x9, 0xef, 0x0,
-    0xaf, 0xd9, 0x8d, 0xd8, 0xf0, 0x0, 0x8e, 0xfe,
-    0x91, 0x8f, 0x0,
-
-    /* U+00FF "ÿ" */
-    0x0, 0x4, 0xe2, 0x1e, 0x70, 0x0, 0x0, 0x5,
-    0xf2, 0x1e, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xd0, 0x0, 0x0, 0xb, 0xe0, 0x6, 0xf3,
-    0x0, 0x0, 0x1f, 0x80, 0x0, 0xf9, 0x0, 0x0,
-    0x6f, 0x20, 0x0, 0x9f, 0x0, 0x0, 0xcb, 0x0,
-    0x0, 0x2f, 0x60, 0x2, 0xf5, 0x0, 0x0, 0xc,
-    0xc0, 0x8, 0xe0, 0x0, 0x0, 0x5, 0xf2, 0xe,
-    0x90, 0x0, 0x0, 0x0, 0xe8, 0x4f, 0x30, 0x0,
-    0x0, 0x0, 0x9e, 0xac, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x30, 0x0, 0x0, 0xb, 0xaa,
-    0xfa, 0x0, 0x0, 0x0, 0x9, 0xee, 0x90, 0x0,
-    0x0, 0x0,
-
-    /* U+2010 "‐" */
-    0xbf, 0xff, 0xf2, 0x33, 0x32,
-
-    /* U+2192 "→" */
-    0x0, 0x0, 0x16, 0x10, 0x0, 0x0, 0x0, 0xca,
-    0x0, 0x0, 0x0, 0x3, 0xf5, 0x0, 0x11, 0x11,
-    0x19, 0xe1, 0x6f, 0xff, 0xff, 0xff, 0x90, 0x22,
-    0x22, 0x29, 0xf1, 0x0, 0x0, 0x2, 0xf6, 0x0,
-    0x0, 0x0, 0xcb, 0x0, 0x0, 0x0, 0x17, 0x10,
-    0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 105, .box_w = 6, .box_h = 5, .ofs_x = 1, .ofs_y = 12},
-    {.bitmap_index = 15, .adv_w = 136, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 83, .adv_w = 208, .box_w = 10, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 183, .adv_w = 208, .box_w = 10, .box_h = 19, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 278, .adv_w = 93, .box_w = 5, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 328, .adv_w = 93, .box_w = 6, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 385, .adv_w = 260, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 545, .adv_w = 245, .box_w = 13, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 669, .adv_w = 208, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 752, .adv_w = 185, .box_w = 9, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 824, .adv_w = 185, .box_w = 9, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 896, .adv_w = 185, .box_w = 9, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 964, .adv_w = 185, .box_w = 9, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1032, .adv_w = 180, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 1115, .adv_w = 188, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1211, .adv_w = 188, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1307, .adv_w = 188, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1397, .adv_w = 188, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1487, .adv_w = 85, .box_w = 5, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1527, .adv_w = 85, .box_w = 7, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 1580, .adv_w = 85, .box_w = 6, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1625, .adv_w = 210, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1708, .adv_w = 198, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1804, .adv_w = 198, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1894, .adv_w = 198, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1984, .adv_w = 207, .box_w = 11, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2072, .adv_w = 207, .box_w = 11, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2160, .adv_w = 207, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2243, .adv_w = 207, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2326, .adv_w = 161, .box_w = 12, .box_h = 19, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 2440, .adv_w = 116, .box_w = 5, .box_h = 2, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 2445, .adv_w = 192, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 1}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_0[] = {
-    0x0, 0xf, 0x19, 0x1a, 0x1d, 0x1e, 0x23, 0x2c,
-    0x2f, 0x30, 0x31, 0x32, 0x34, 0x37, 0x38, 0x39,
-    0x3a, 0x3b, 0x3d, 0x3e, 0x3f, 0x41, 0x43, 0x44,
-    0x46, 0x49, 0x4a, 0x4b, 0x4c, 0x4f, 0x1f60, 0x20e2
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 176, .range_length = 8419, .glyph_id_start = 1,
-        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 32, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-/*-----------------
- *    KERNING
- *----------------*/
-
-
-/*Pair left and right glyphs for kerning*/
-static const uint8_t kern_pair_glyph_ids[] =
-{
-    23, 9
-};
-
-/* Kerning between the respective left and right glyphs
- * 4.4 format which needs to scaled with `kern_scale`*/
-static const int8_t kern_pair_values[] =
-{
-    -1
-};
-
-/*Collect the kern pair's data in one place*/
-static const lv_font_fmt_txt_kern_pair_t kern_pairs =
-{
-    .glyph_ids = kern_pair_glyph_ids,
-    .values = kern_pair_values,
-    .pair_cnt = 1,
-    .glyph_ids_size = 0
-};
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = &kern_pairs,
-    .kern_scale = 16,
-    .cmap_num = 1,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-    .cache = &cache
-#endif
-
-};
-
-extern const lv_font_t lv_font_montserrat_20;
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t lv_font_montserrat_latin_20 = {
-#else
-lv_font_t lv_font_montserrat_latin_20 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 24,          /*The maximum line height required by the font*/
-    .base_line = 4,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -2,
-    .underline_thickness = 1,
-#endif
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-    .fallback = &lv_font_montserrat_20,
-#endif
-    .user_data = NULL,
-};
-
-
-
-#endif /*#if LV_FONT_MONTSERRAT_LATIN_20*/
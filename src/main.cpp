@@ -3,6 +3,8 @@
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
 #include <ArduinoOTA.h>
+#include <ESPmDNS.h>
+#include <WebServer.h>
 #include <time.h>
 #include <lvgl.h>
 #include <TFT_eSPI.h>
@@ -10,6 +12,20 @@
 #include <Preferences.h>
 #include "esp_system.h"
 #include "translations.h"
+#include "city_index.h"
+#include "tfl_arrivals.h"
+#include "open_meteo.h"
+#include "theme.h"
+#include "assets.h"
+#include "forecast_table.h"
+#include "metrics.h"
+#include "stall.h"
+#include "trace.h"
+#include "str_builder.h"
+#include "arena.h"
+#include "soak.h"
+#include "traffic.h"
+#include "schedule.h"
 
 // Optional compile-time configuration
 // Copy config.h.example to config.h and customize
@@ -20,6 +36,9 @@
 #define HAS_CONFIG_H 0
 #endif
 
+// After config.h, which may set CONFIG_LOG_LEVEL
+#include "log.h"
+
 // Default values for optional config
 #ifndef WIFI_SSID
 #define WIFI_SSID ""
@@ -69,12 +88,36 @@
 #ifndef CONFIG_AUTO_ROTATE_INTERVAL
 #define CONFIG_AUTO_ROTATE_INTERVAL 10000
 #endif
+#ifndef CONFIG_PANEL_SLIDE
+#define CONFIG_PANEL_SLIDE true
+#endif
 #ifndef CONFIG_OTA_HOSTNAME
 #define CONFIG_OTA_HOSTNAME "aura"
 #endif
 #ifndef CONFIG_OTA_PASSWORD
 #define CONFIG_OTA_PASSWORD ""
 #endif
+#ifndef CONFIG_LOG_FRAME_TIMES
+#define CONFIG_LOG_FRAME_TIMES false
+#endif
+#ifndef CONFIG_METRICS_PORT
+#define CONFIG_METRICS_PORT 80
+#endif
+#ifndef CONFIG_STALL_THRESHOLD_MS
+#define CONFIG_STALL_THRESHOLD_MS 100
+#endif
+#ifndef CONFIG_SOAK_TEST
+#define CONFIG_SOAK_TEST 0
+#endif
+#ifndef CONFIG_TRAFFIC_SIM
+#define CONFIG_TRAFFIC_SIM 0
+#endif
+#if CONFIG_SOAK_TEST && CONFIG_TRAFFIC_SIM
+#error "CONFIG_SOAK_TEST and CONFIG_TRAFFIC_SIM are separate builds"
+#endif
+
+// LVGL timer callback that the stall monitor times under its own name
+#define STALL_TIMER(cb) [](lv_timer_t *timer) { StallScope stall(#cb); cb(timer); }
 
 #define XPT2046_IRQ 36   // T_IRQ
 #define XPT2046_MOSI 32  // T_DIN
@@ -90,7 +133,20 @@
 #define LONGITUDE_DEFAULT "-0.1278"
 #define LOCATION_DEFAULT "London"
 #define DEFAULT_CAPTIVE_SSID "Aura"
-#define UPDATE_INTERVAL 600000UL  // 10 minutes
+#define MAX_LOCATIONS 3
+#define HTTP_READ_TIMEOUT 5000  // ms without data before giving up on a response
+
+// CONFIG_API_STUB, e.g. "http://192.168.1.20:8080", sends every API request
+// to a local stand-in instead (scripts/fault_server.py)
+#ifdef CONFIG_API_STUB
+#define FORECAST_URL CONFIG_API_STUB "/v1/forecast"
+#define GEOCODE_URL CONFIG_API_STUB "/v1/search"
+#define TFL_STOP_URL CONFIG_API_STUB "/StopPoint/"
+#else
+#define FORECAST_URL "http://api.open-meteo.com/v1/forecast"
+#define GEOCODE_URL "https://geocoding-api.open-meteo.com/v1/search"
+#define TFL_STOP_URL "https://api.tfl.gov.uk/StopPoint/"
+#endif
 
 // Night mode starts at 10pm and ends at 6am
 #define NIGHT_MODE_START_HOUR 22
@@ -99,7 +155,6 @@
 LV_FONT_DECLARE(lv_font_montserrat_latin_12);
 LV_FONT_DECLARE(lv_font_montserrat_latin_14);
 LV_FONT_DECLARE(lv_font_montserrat_latin_16);
-LV_FONT_DECLARE(lv_font_montserrat_latin_20);
 LV_FONT_DECLARE(lv_font_montserrat_latin_42);
 
 static Language current_language = LANG_EN;
@@ -117,10 +172,6 @@ const lv_font_t* get_font_16() {
   return &lv_font_montserrat_latin_16;
 }
 
-const lv_font_t* get_font_20() {
-  return &lv_font_montserrat_latin_20;
-}
-
 const lv_font_t* get_font_42() {
   return &lv_font_montserrat_latin_42;
 }
@@ -135,12 +186,84 @@ static Preferences prefs;
 static bool use_fahrenheit = false;
 static bool use_24_hour = false; 
 static bool use_night_mode = false;
-static char latitude[16] = LATITUDE_DEFAULT;
-static char longitude[16] = LONGITUDE_DEFAULT;
-static String location = String(LOCATION_DEFAULT);
-static char dd_opts[512];
-static DynamicJsonDocument geoDoc(8 * 1024);
-static JsonArray geoResults;
+
+// Saved locations; slot 0 is home and sets the clock's time zone
+struct SavedLocation {
+  char latitude[16];
+  char longitude[16];
+  char name[64];
+};
+static SavedLocation locations[MAX_LOCATIONS];
+static int location_count = 1;
+static int current_location = 0;  // Location shown on screen
+static int edit_location = 0;     // Slot chosen in the location dialog
+static lv_timer_t *location_rotate_timer = nullptr;
+
+// Compact forecast for each location, parsed from the batched response
+static WeatherModel weather[MAX_LOCATIONS];
+
+// Location search results, from the offline city index or the geocoding API
+struct GeoResult {
+  const char *name;
+  const char *admin1;  // nullptr if unknown
+  int32_t lat_e5;      // 1e-5 degrees
+  int32_t lon_e5;
+};
+#define MAX_GEO_RESULTS 15
+#define GEO_CACHE_ENTRIES 4
+#define GEO_CACHE_TEXT_SIZE 640
+#define GEO_QUERY_MAX 32
+#define GEO_DEBOUNCE_MS 400
+
+// Online results for one query; names are copied into the entry's own text.
+// Queries without matches are kept too (count 0), so asking again does not
+// go back to the network.
+struct GeoCacheEntry {
+  char query[GEO_QUERY_MAX];
+  uint32_t last_used;  // 0 = empty
+  uint8_t count;
+  GeoResult results[MAX_GEO_RESULTS];
+  char text[GEO_CACHE_TEXT_SIZE];
+};
+
+// Everything the location search needs, allocated when location_win opens
+// and released when it closes so nothing is pinned for the device's lifetime
+struct GeoSearchArena {
+  GeoCacheEntry cache[GEO_CACHE_ENTRIES];
+  uint32_t cache_clock;
+  GeoResult index_results[MAX_GEO_RESULTS];
+  char dd_opts[MAX_GEO_RESULTS * 64];
+};
+static GeoSearchArena *geo_arena = nullptr;
+static const GeoResult *geo_results = nullptr;
+static int geo_result_count = 0;
+static lv_timer_t *geo_debounce_timer = nullptr;
+
+// Scratch for one fetch/parse cycle: the weather models being parsed and
+// the geocoding JSON documents. Reserved once so the general heap never
+// holds them; each fetch releases what it used with an ArenaScope.
+#define REFRESH_ARENA_SIZE (8 * 1024)
+static uint8_t refresh_arena_mem[REFRESH_ARENA_SIZE];
+static Arena refresh_arena(refresh_arena_mem, sizeof(refresh_arena_mem));
+
+// Lets ArduinoJson documents take their memory from refresh_arena
+class RefreshArenaAllocator : public ArduinoJson::Allocator {
+public:
+  void *allocate(size_t size) override { return refresh_arena.alloc(size); }
+  void deallocate(void *ptr) override { refresh_arena.free(ptr); }
+  void *reallocate(void *ptr, size_t size) override { return refresh_arena.realloc(ptr, size); }
+};
+static RefreshArenaAllocator refresh_json_allocator;
+
+// Screen background gradient, cached as bands of one RGB565 color
+#define MAX_BG_BANDS 64
+struct BackgroundBand {
+  int16_t y1;
+  int16_t y2;
+  lv_color_t color;
+};
+static BackgroundBand bg_bands[MAX_BG_BANDS];
+static int bg_band_count = 0;
 
 // Screen dimming variables
 static bool night_mode_active = false;
@@ -151,11 +274,43 @@ static lv_timer_t *temp_screen_wakeup_timer = nullptr;
 static bool auto_rotate_enabled = false;
 static uint32_t auto_rotate_interval = 10000;  // Default 10 seconds
 static lv_timer_t *auto_rotate_timer = nullptr;
-static int current_panel = 0;  // 0=daily, 1=hourly, 2=transit
+
+// Panels below the current conditions; only current_panel is on screen
+enum Panel { PANEL_DAILY, PANEL_HOURLY, PANEL_TRANSIT, PANEL_COUNT };
+static int current_panel = PANEL_DAILY;
+
+// Set when a panel's data changed while it was hidden; it is rendered the
+// next time it is shown
+static bool panel_dirty[PANEL_COUNT];
+
+#define PANEL_WIDTH 220
+#define PANEL_HEIGHT 180
+
+// With CONFIG_PANEL_SLIDE, panel switches slide the outgoing and incoming
+// panels side by side across the screen. Snapshots of both would take two
+// 79 KB buffers, more than esp32dev has to spare, so the panels are moved
+// with translate_x and redrawn each frame instead. Each is a single widget
+// drawing its own rows (forecast_table.h), or a few labels for transit.
+#define PANEL_SLIDE_TIME 300  // ms
+#define PANEL_SLIDE_GAP 10    // px between the two panels
+static lv_obj_t *slide_from = nullptr;    // Panel hidden when the slide ends
+static lv_obj_t *slide_target = nullptr;  // Panel shown when the slide ends
+static uint32_t slide_worst_frame_us = 0;
+
+#define PANEL_RADIUS 4
 
 // Transit refresh timer
 static lv_timer_t *transit_refresh_timer = nullptr;
-#define TRANSIT_REFRESH_INTERVAL 5000  // 5 seconds
+
+// Shared styles for the main screen, set up once by init_styles() so the
+// widgets below only carry their own position as local style
+static bool styles_ready = false;
+static lv_style_t style_label;          // White text
+static lv_style_t style_row;            // Forecast tables: day, hour and temperatures
+static lv_style_t style_row_secondary;  // Forecast tables: low temperature and precipitation
+static lv_style_t style_caption;        // Small captions and transit arrivals
+static lv_style_t style_header;         // Transit section headers
+static lv_style_t style_panel;          // Forecast and transit panels
 
 // UI components
 static lv_obj_t *lbl_today_temp;
@@ -164,19 +319,15 @@ static lv_obj_t *lbl_sunrise;
 static lv_obj_t *lbl_sunset;
 static lv_obj_t *img_today_icon;
 static lv_obj_t *lbl_forecast;
+static lv_obj_t *lbl_location_name;
 static lv_obj_t *box_daily;
 static lv_obj_t *box_hourly;
-static lv_obj_t *lbl_daily_day[7];
-static lv_obj_t *lbl_daily_high[7];
-static lv_obj_t *lbl_daily_low[7];
-static lv_obj_t *img_daily[7];
-static lv_obj_t *lbl_hourly[7];
-static lv_obj_t *lbl_precipitation_probability[7];
-static lv_obj_t *lbl_hourly_temp[7];
-static lv_obj_t *img_hourly[7];
+static ForecastTable daily_table;
+static ForecastTable hourly_table;
 static lv_obj_t *lbl_loc;
 static lv_obj_t *loc_ta;
 static lv_obj_t *results_dd;
+static lv_obj_t *slot_dd;
 static lv_obj_t *btn_close_loc;
 static lv_obj_t *btn_close_obj;
 static lv_obj_t *kb;
@@ -188,6 +339,7 @@ static lv_obj_t *night_mode_switch;
 static lv_obj_t *auto_rotate_switch;
 static lv_obj_t *language_dropdown;
 static lv_obj_t *lbl_clock;
+static uint32_t main_screen_heap = 0;
 
 // Transit UI components
 static lv_obj_t *box_transit;
@@ -207,74 +359,31 @@ static char tube_station_id[32] = "";
 static bool transit_enabled = false;
 
 // Transit data storage
-struct ArrivalInfo {
-  char line[16];
-  char destination[32];
-  int timeToStation;  // seconds
-};
-static ArrivalInfo bus_arrivals[4];
-static ArrivalInfo tube_arrivals[4];
+static ArrivalInfo bus_arrivals[ARRIVALS_SHOWN];
+static ArrivalInfo tube_arrivals[ARRIVALS_SHOWN];
 static int bus_arrival_count = 0;
 static int tube_arrival_count = 0;
 
-// Weather icons
-LV_IMG_DECLARE(icon_blizzard);
-LV_IMG_DECLARE(icon_blowing_snow);
-LV_IMG_DECLARE(icon_clear_night);
-LV_IMG_DECLARE(icon_cloudy);
-LV_IMG_DECLARE(icon_drizzle);
-LV_IMG_DECLARE(icon_flurries);
-LV_IMG_DECLARE(icon_haze_fog_dust_smoke);
-LV_IMG_DECLARE(icon_heavy_rain);
-LV_IMG_DECLARE(icon_heavy_snow);
-LV_IMG_DECLARE(icon_isolated_scattered_tstorms_day);
-LV_IMG_DECLARE(icon_isolated_scattered_tstorms_night);
-LV_IMG_DECLARE(icon_mostly_clear_night);
-LV_IMG_DECLARE(icon_mostly_cloudy_day);
-LV_IMG_DECLARE(icon_mostly_cloudy_night);
-LV_IMG_DECLARE(icon_mostly_sunny);
-LV_IMG_DECLARE(icon_partly_cloudy);
-LV_IMG_DECLARE(icon_partly_cloudy_night);
-LV_IMG_DECLARE(icon_scattered_showers_day);
-LV_IMG_DECLARE(icon_scattered_showers_night);
-LV_IMG_DECLARE(icon_showers_rain);
-LV_IMG_DECLARE(icon_sleet_hail);
-LV_IMG_DECLARE(icon_snow_showers_snow);
-LV_IMG_DECLARE(icon_strong_tstorms);
-LV_IMG_DECLARE(icon_sunny);
-LV_IMG_DECLARE(icon_tornado);
-LV_IMG_DECLARE(icon_wintry_mix_rain_snow);
-
-// Weather Images
-LV_IMG_DECLARE(image_blizzard);
-LV_IMG_DECLARE(image_blowing_snow);
-LV_IMG_DECLARE(image_clear_night);
-LV_IMG_DECLARE(image_cloudy);
-LV_IMG_DECLARE(image_drizzle);
-LV_IMG_DECLARE(image_flurries);
-LV_IMG_DECLARE(image_haze_fog_dust_smoke);
-LV_IMG_DECLARE(image_heavy_rain);
-LV_IMG_DECLARE(image_heavy_snow);
-LV_IMG_DECLARE(image_isolated_scattered_tstorms_day);
-LV_IMG_DECLARE(image_isolated_scattered_tstorms_night);
-LV_IMG_DECLARE(image_mostly_clear_night);
-LV_IMG_DECLARE(image_mostly_cloudy_day);
-LV_IMG_DECLARE(image_mostly_cloudy_night);
-LV_IMG_DECLARE(image_mostly_sunny);
-LV_IMG_DECLARE(image_partly_cloudy);
-LV_IMG_DECLARE(image_partly_cloudy_night);
-LV_IMG_DECLARE(image_scattered_showers_day);
-LV_IMG_DECLARE(image_scattered_showers_night);
-LV_IMG_DECLARE(image_showers_rain);
-LV_IMG_DECLARE(image_sleet_hail);
-LV_IMG_DECLARE(image_snow_showers_snow);
-LV_IMG_DECLARE(image_strong_tstorms);
-LV_IMG_DECLARE(image_sunny);
-LV_IMG_DECLARE(image_tornado);
-LV_IMG_DECLARE(image_wintry_mix_rain_snow);
+// Forecast icons, pre-blended onto the panel color while it matches
+#if ASSET_PANEL_BLEND_COLOR == PANEL_BG_COLOR
+#define PANEL_ICON(name) ASSET_IMAGE(name##_on_panel)
+#else
+#define PANEL_ICON(name) ASSET_IMAGE(name)
+#endif
 
 void create_ui();
 void fetch_and_update_weather();
+static void apply_forecast(const WeatherModel *models);
+static void poll_weather_refresh();
+#if CONFIG_SOAK_TEST
+static void soak_begin();
+static void soak_loop();
+#endif
+#if CONFIG_TRAFFIC_SIM
+static void sim_begin();
+static void sim_loop();
+#endif
+void render_weather();
 void create_settings_window();
 static void screen_event_cb(lv_event_t *e);
 static void settings_event_handler(lv_event_t *e);
@@ -282,8 +391,12 @@ const lv_img_dsc_t *choose_image(int wmo_code, int is_day);
 const lv_img_dsc_t *choose_icon(int wmo_code, int is_day);
 
 // Location/geocoding functions
-void do_geocode_query(const char *q);
+void run_location_search(const char *q, bool allow_online);
+const GeoCacheEntry *do_geocode_query(const char *q);
 void create_location_dialog();
+void load_locations();
+void save_locations();
+void update_location_rotation();
 
 // WiFi/AP mode functions
 void apModeCallback(WiFiManager *mgr);
@@ -292,6 +405,8 @@ void wifi_splash_screen();
 // UI callback functions
 void daily_cb(lv_event_t *e);
 void hourly_cb(lv_event_t *e);
+static void show_panel(int panel);
+static void mark_panel_dirty(int panel);
 static void reset_confirm_yes_cb(lv_event_t *e);
 static void reset_confirm_no_cb(lv_event_t *e);
 
@@ -318,50 +433,62 @@ void start_auto_rotation();
 void stop_auto_rotation();
 void rotate_to_next_panel();
 
+#if CONFIG_TRAFFIC_SIM
+#define SIM_EPOCH 1767225600UL       // 2026-01-01 00:00 UTC
+#define SIM_STEP_MS 100              // Simulated time per loop() pass
+#define SIM_DURATION_MS 86400000UL   // One day
+#define SIM_BODY_MAX 4096
+#define SIM_ARRIVALS 12              // Predictions in each stub TfL response
 
-int day_of_week(int y, int m, int d) {
-  static const int t[] = { 0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4 };
-  if (m < 3) y -= 1;
-  return (y + y / 4 - y / 100 + y / 400 + t[m - 1] + d) % 7;
-}
-
-String hour_of_day(int hour) {
-  const LocalizedStrings* strings = get_strings(current_language);
-  if(hour < 0 || hour > 23) return String(strings->invalid_hour);
+// Virtual time since boot, behind the refresh schedule, the clock and the
+// LVGL tick in the traffic simulation
+static uint32_t sim_ms = 0;
+#endif
 
-  if (use_24_hour) {
-    if (hour < 10)
-      return String("0") + String(hour);
-    else
-      return String(hour);
-  } else {
-    if(hour == 0)   return String("12") + strings->am;
-    if(hour == 12)  return String(strings->noon);
+// Milliseconds since boot, for scheduling
+static uint32_t now_ms() {
+#if CONFIG_TRAFFIC_SIM
+  return sim_ms;
+#else
+  return millis();
+#endif
+}
 
-    bool isMorning = (hour < 12);
-    String suffix = isMorning ? strings->am : strings->pm;
+static bool local_time(struct tm *out) {
+#if CONFIG_TRAFFIC_SIM
+  time_t t = SIM_EPOCH + sim_ms / 1000;
+  localtime_r(&t, out);
+  return true;
+#else
+  return getLocalTime(out);
+#endif
+}
 
-    int displayHour = hour % 12;
+static bool network_up() {
+#if CONFIG_TRAFFIC_SIM
+  return true;  // Every request goes to a stub endpoint
+#else
+  return WiFi.status() == WL_CONNECTED;
+#endif
+}
 
-    return String(displayHour) + suffix;
+// Hourly forecast label such as "07", "7am" or "Noon"
+void hour_of_day(StrBuilder &out, int hour) {
+  const LocalizedStrings* strings = get_strings(current_language);
+  if (hour < 0 || hour > 23) {
+    out.add(strings->invalid_hour);
+    return;
   }
-}
 
-String urlencode(const String &str) {
-  String encoded = "";
-  char buf[5];
-  for (size_t i = 0; i < str.length(); i++) {
-    char c = str.charAt(i);
-    // Unreserved characters according to RFC 3986
-    if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '-' || c == '_' || c == '.' || c == '~') {
-      encoded += c;
-    } else {
-      // Percent-encode others
-      sprintf(buf, "%%%02X", (unsigned char)c);
-      encoded += buf;
-    }
+  if (use_24_hour) {
+    out.add_int(hour, 2);
+  } else if (hour == 0) {
+    out.add("12").add(strings->am);
+  } else if (hour == 12) {
+    out.add(strings->noon);
+  } else {
+    out.add_int(hour % 12).add(hour < 12 ? strings->am : strings->pm);
   }
-  return encoded;
 }
 
 static void update_clock(lv_timer_t *timer) {
@@ -369,7 +496,7 @@ static void update_clock(lv_timer_t *timer) {
 
   check_for_night_mode();
 
-  if (!getLocalTime(&timeinfo)) return;
+  if (!local_time(&timeinfo)) return;
 
   const LocalizedStrings* strings = get_strings(current_language);
   char buf[16];
@@ -398,19 +525,36 @@ static void kb_event_cb(lv_event_t *e) {
   lv_obj_t *kb = static_cast<lv_obj_t *>(lv_event_get_target(e));
   lv_obj_add_flag((lv_obj_t *)lv_event_get_target(e), LV_OBJ_FLAG_HIDDEN);
 
-  if (lv_event_get_code(e) == LV_EVENT_READY) {
-    const char *loc = lv_textarea_get_text(loc_ta);
-    if (strlen(loc) > 0) {
-      do_geocode_query(loc);
-    }
+  if (lv_event_get_code(e) == LV_EVENT_READY && location_win && lv_keyboard_get_textarea(kb) == loc_ta) {
+    // Enter searches immediately, online too if the offline index has no match
+    lv_timer_pause(geo_debounce_timer);
+    run_location_search(lv_textarea_get_text(loc_ta), true);
   }
 }
 
+// Restart the debounce window on every keystroke in the location search box
+static void loc_ta_changed_cb(lv_event_t *e) {
+  lv_timer_reset(geo_debounce_timer);
+  lv_timer_resume(geo_debounce_timer);
+}
+
+// Type-ahead only searches the offline index. An online search blocks the
+// loop task for the whole HTTPS request, so it waits for Enter.
+static void geo_debounce_cb(lv_timer_t *timer) {
+  lv_timer_pause(timer);
+  run_location_search(lv_textarea_get_text(loc_ta), false);
+}
+
 static void ta_defocus_cb(lv_event_t *e) {
   lv_obj_add_flag((lv_obj_t *)lv_event_get_user_data(e), LV_OBJ_FLAG_HIDDEN);
 }
 
+// When LVGL dispatched the last tap that has not been answered with a redraw
+static uint32_t touch_start_us = 0;
+
 void touchscreen_read(lv_indev_t *indev, lv_indev_data_t *data) {
+  StallScope stall("touchscreen_read");
+  static bool was_pressed = false;  // LVGL clears data before every read
   if (touchscreen.tirqTouched() && touchscreen.touched()) {
     TS_Point p = touchscreen.getPoint();
 
@@ -426,9 +570,9 @@ void touchscreen_read(lv_indev_t *indev, lv_indev_data_t *data) {
       if (temp_screen_wakeup_timer) {
         lv_timer_del(temp_screen_wakeup_timer);
       }
-      temp_screen_wakeup_timer = lv_timer_create(handle_temp_screen_wakeup_timeout, 15000, NULL);
+      temp_screen_wakeup_timer = lv_timer_create(STALL_TIMER(handle_temp_screen_wakeup_timeout), 15000, NULL);
       lv_timer_set_repeat_count(temp_screen_wakeup_timer, 1); // Run only once
-      Serial.println("Woke up screen. Setting timer to turn of screen after 15 seconds of inactivity.");
+      LOG_D("Woke up screen. Setting timer to turn of screen after 15 seconds of inactivity.");
 
       if (!temp_screen_wakeup_active) {
           // If this is the wake-up tap, don't pass this touch to the UI - just undim the screen
@@ -440,47 +584,175 @@ void touchscreen_read(lv_indev_t *indev, lv_indev_data_t *data) {
       temp_screen_wakeup_active = true;
     }
 
+    if (!was_pressed) metrics_touch();
+    was_pressed = true;
     data->state = LV_INDEV_STATE_PRESSED;
     data->point.x = x;
     data->point.y = y;
   } else {
+    was_pressed = false;
     data->state = LV_INDEV_STATE_RELEASED;
   }
 }
 
+// A tap's latency starts when the input device sends LV_EVENT_CLICKED,
+// before the clicked widget's own handlers run, so their work is counted
+static void touch_clicked_cb(lv_event_t *e) {
+  touch_start_us = micros() | 1;  // 0 means no tap pending
+}
+
+// Times each redraw, from rendering the first invalid area to flushing the
+// last one, and a tap from its click to the end of the next redraw
+static void frame_time_cb(lv_event_t *e) {
+  static uint32_t render_start = 0;
+  if (lv_event_get_code(e) == LV_EVENT_RENDER_START) {
+    render_start = micros();
+  } else {
+    uint32_t now = micros();
+    uint32_t frame_us = now - render_start;
+    metrics_frame(frame_us);
+    if (slide_from && frame_us > slide_worst_frame_us) slide_worst_frame_us = frame_us;
+    if (touch_start_us) {
+      metrics_touch_latency(now - touch_start_us);
+      touch_start_us = 0;
+    }
+    if (CONFIG_LOG_FRAME_TIMES) LOG_I("Frame: %lu us", (unsigned long)frame_us);
+  }
+}
+
+static WebServer metrics_server(CONFIG_METRICS_PORT);
+static char metrics_page[7168];  // ~5.3 KB in use with three hosts
+
+// GET /metrics: Prometheus text exposition, served from the loop task
+static void handle_metrics() {
+  MetricsGauges gauges = {};
+  gauges.heap_free = ESP.getFreeHeap();
+  gauges.heap_min_free = ESP.getMinFreeHeap();
+  gauges.heap_largest_block = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  gauges.wifi_rssi = WiFi.status() == WL_CONNECTED ? WiFi.RSSI() : 0;
+  gauges.uptime_s = millis() / 1000;
+  gauges.log_dropped = log_dropped();
+  gauges.arena_capacity = refresh_arena.capacity();
+  gauges.arena_high_water = refresh_arena.high_water();
+  gauges.arena_failures = refresh_arena.failures();
+  gauges.main_screen_heap = main_screen_heap;
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+  lv_mem_monitor_t mon;
+  lv_mem_monitor(&mon);
+  gauges.lvgl_mem_total = mon.total_size;
+  gauges.lvgl_mem_used = mon.total_size - mon.free_size;
+#endif
+
+  size_t len = metrics_format(metrics_page, sizeof(metrics_page), gauges);
+  metrics_server.send_P(200, "text/plain; version=0.0.4", metrics_page, len);
+}
+
+// Set by POST /refresh, picked up by the loop
+static bool weather_refresh_requested = false;
+
+#ifdef CONFIG_API_STUB
+// POST /refresh: fetch the forecast now rather than at the next interval.
+// Stub builds only: it is unauthenticated and each fetch blocks the UI.
+static void handle_refresh() {
+  weather_refresh_requested = true;
+  metrics_server.send(202, "text/plain", "Refreshing\n");
+}
+#endif
+
+// GET /trace: boot and recent spans as Chrome trace JSON, sent in chunks
+static void handle_trace() {
+  metrics_server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  metrics_server.send(200, "application/json", "");
+  trace_write_json([](const char *text, size_t len, void *) { metrics_server.sendContent(text, len); }, nullptr);
+  metrics_server.sendContent("");
+}
+
+// Requests per host over elapsed_ms, scaled to a day
+static void dump_traffic(uint32_t elapsed_ms) {
+  char table[1024];
+  traffic_format(table, sizeof(table), elapsed_ms);
+  log_flush(200);
+  Serial.println("--- BEGIN TRAFFIC ---");
+  Serial.print(table);
+  Serial.println("--- END TRAFFIC ---");
+}
+
+// Serial console commands, one per line. "trace" dumps the same JSON as
+// /trace between BEGIN/END marker lines, "traffic" the requests per host.
+static void poll_serial_commands() {
+  static char line[16];
+  static size_t len = 0;
+  while (Serial.available()) {
+    char c = Serial.read();
+    if (c != '\n' && c != '\r') {
+      if (len < sizeof(line) - 1) line[len++] = c;
+      continue;
+    }
+    line[len] = '\0';
+    len = 0;
+    if (strcmp(line, "trace") == 0) {
+      log_flush(200);
+      Serial.println("--- BEGIN TRACE ---");
+      trace_write_json([](const char *text, size_t n, void *) { Serial.write((const uint8_t *)text, n); }, nullptr);
+      Serial.println("--- END TRACE ---");
+    } else if (strcmp(line, "traffic") == 0) {
+      dump_traffic(millis());
+    }
+  }
+}
+
+// Last tenth of an OTA upload that was logged
+static int ota_progress_step = -1;
+
 void setup() {
+  // Each phase of cold start is a span in the boot trace
+  trace_begin("setup");
+  trace_begin("serial_init");
   Serial.begin(115200);
+  log_init();
+  stall_init(CONFIG_STALL_THRESHOLD_MS);
   delay(100);
+  trace_end();
 
+  trace_begin("tft_init");
   TFT_eSPI tft = TFT_eSPI();
   tft.init();
   pinMode(LCD_BACKLIGHT_PIN, OUTPUT);
+  trace_end();
 
+  trace_begin("lv_init");
   lv_init();
+  trace_end();
+
+  trace_begin("assets_init");
+  if (!assets_init()) {
+    LOG_E("Asset partition missing or out of date, images disabled - flash over USB with make upload");
+  }
+  trace_end();
 
   // Init touchscreen
+  trace_begin("touch_init");
   touchscreenSPI.begin(XPT2046_CLK, XPT2046_MISO, XPT2046_MOSI, XPT2046_CS);
   touchscreen.begin(touchscreenSPI);
   touchscreen.setRotation(0);
+  trace_end();
 
+  trace_begin("display_init");
   lv_display_t *disp = lv_tft_espi_create(SCREEN_WIDTH, SCREEN_HEIGHT, draw_buf, sizeof(draw_buf));
   lv_indev_t *indev = lv_indev_create();
   lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
   lv_indev_set_read_cb(indev, touchscreen_read);
+  lv_indev_add_event_cb(indev, touch_clicked_cb, LV_EVENT_CLICKED, NULL);
+  lv_display_add_event_cb(disp, frame_time_cb, LV_EVENT_RENDER_START, NULL);
+  lv_display_add_event_cb(disp, frame_time_cb, LV_EVENT_RENDER_READY, NULL);
+  trace_end();
 
   // Load saved prefs with compile-time config as defaults
+  trace_begin("prefs_load");
   prefs.begin("weather", false);
   
-  // Location: use compile-time config if set, otherwise use hardcoded defaults
-  const char* lat_default = (strlen(CONFIG_LATITUDE) > 0) ? CONFIG_LATITUDE : LATITUDE_DEFAULT;
-  const char* lon_default = (strlen(CONFIG_LONGITUDE) > 0) ? CONFIG_LONGITUDE : LONGITUDE_DEFAULT;
-  const char* loc_default = (strlen(CONFIG_LOCATION) > 0) ? CONFIG_LOCATION : LOCATION_DEFAULT;
-  
-  String lat = prefs.getString("latitude", lat_default);
-  lat.toCharArray(latitude, sizeof(latitude));
-  String lon = prefs.getString("longitude", lon_default);
-  lon.toCharArray(longitude, sizeof(longitude));
-  location = prefs.getString("location", loc_default);
+  // Locations: use compile-time config if set, otherwise use hardcoded defaults
+  load_locations();
   
   // Display preferences: use compile-time config as defaults
   use_fahrenheit = prefs.getBool("useFahrenheit", CONFIG_USE_FAHRENHEIT);
@@ -506,27 +778,37 @@ void setup() {
   transit_enabled = (any_bus_stop_configured() || strlen(tube_station_id) > 0);
   
   analogWrite(LCD_BACKLIGHT_PIN, brightness);
+  trace_end();
+
+#if CONFIG_SOAK_TEST
+  soak_begin();
+  return;
+#endif
+#if CONFIG_TRAFFIC_SIM
+  sim_begin();
+  return;
+#endif
 
   // Check for Wi-Fi config and request it if not available
+  trace_begin("wifi_connect");
   WiFiManager wm;
   wm.setAPCallback(apModeCallback);
   
   // Use compile-time WiFi credentials if configured
   #if defined(WIFI_SSID) && defined(WIFI_PASSWORD)
   if (strlen(WIFI_SSID) > 0 && strlen(WIFI_PASSWORD) > 0) {
-    Serial.println("Using compile-time WiFi credentials");
+    LOG_I("Using compile-time WiFi credentials");
     WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
     int timeout = 20; // 10 second timeout
     while (WiFi.status() != WL_CONNECTED && timeout > 0) {
       delay(500);
-      Serial.print(".");
       timeout--;
     }
     if (WiFi.status() != WL_CONNECTED) {
-      Serial.println("\nCompile-time WiFi failed, falling back to WiFiManager");
+      LOG_W("Compile-time WiFi failed, falling back to WiFiManager");
       wm.autoConnect(DEFAULT_CAPTIVE_SSID);
     } else {
-      Serial.println("\nWiFi connected!");
+      LOG_I("WiFi connected!");
     }
   } else {
     wm.autoConnect(DEFAULT_CAPTIVE_SSID);
@@ -534,43 +816,76 @@ void setup() {
   #else
   wm.autoConnect(DEFAULT_CAPTIVE_SSID);
   #endif
+  trace_end();
 
   // Setup OTA updates
+  trace_begin("ota_setup");
   ArduinoOTA.setHostname(CONFIG_OTA_HOSTNAME);
   if (strlen(CONFIG_OTA_PASSWORD) > 0) {
     ArduinoOTA.setPassword(CONFIG_OTA_PASSWORD);
   }
   
   ArduinoOTA.onStart([]() {
-    String type = (ArduinoOTA.getCommand() == U_FLASH) ? "firmware" : "filesystem";
-    Serial.println("OTA update starting: " + type);
+    ota_progress_step = -1;
+    LOG_I("OTA update starting: %s", (ArduinoOTA.getCommand() == U_FLASH) ? "firmware" : "filesystem");
   });
   
   ArduinoOTA.onEnd([]() {
-    Serial.println("\nOTA update complete!");
+    LOG_I("OTA update complete!");
+    log_flush(500);  // ArduinoOTA restarts straight after this
   });
   
+  // Called for every chunk received, so only log each 10%
   ArduinoOTA.onProgress([](unsigned int progress, unsigned int total) {
-    Serial.printf("OTA Progress: %u%%\r", (progress / (total / 100)));
+    unsigned int percent = total ? (unsigned int)((uint64_t)progress * 100 / total) : 0;
+    if ((int)(percent / 10) != ota_progress_step) {
+      ota_progress_step = percent / 10;
+      LOG_I("OTA Progress: %u%%", percent);
+    }
   });
   
   ArduinoOTA.onError([](ota_error_t error) {
-    Serial.printf("OTA Error[%u]: ", error);
-    if (error == OTA_AUTH_ERROR) Serial.println("Auth Failed");
-    else if (error == OTA_BEGIN_ERROR) Serial.println("Begin Failed");
-    else if (error == OTA_CONNECT_ERROR) Serial.println("Connect Failed");
-    else if (error == OTA_RECEIVE_ERROR) Serial.println("Receive Failed");
-    else if (error == OTA_END_ERROR) Serial.println("End Failed");
+    const char *reason = "";
+    if (error == OTA_AUTH_ERROR) reason = "Auth Failed";
+    else if (error == OTA_BEGIN_ERROR) reason = "Begin Failed";
+    else if (error == OTA_CONNECT_ERROR) reason = "Connect Failed";
+    else if (error == OTA_RECEIVE_ERROR) reason = "Receive Failed";
+    else if (error == OTA_END_ERROR) reason = "End Failed";
+    LOG_E("OTA Error[%u]: %s", error, reason);
   });
   
   ArduinoOTA.begin();
-  Serial.println("OTA ready. Hostname: " + String(CONFIG_OTA_HOSTNAME));
+  LOG_I("OTA ready. Hostname: %s", CONFIG_OTA_HOSTNAME);
+
+  // ArduinoOTA.begin() has started mDNS under the OTA hostname
+  metrics_server.on("/metrics", HTTP_GET, handle_metrics);
+  metrics_server.on("/trace", HTTP_GET, handle_trace);
+#ifdef CONFIG_API_STUB
+  metrics_server.on("/refresh", HTTP_POST, handle_refresh);
+#endif
+  metrics_server.begin();
+  MDNS.addService("http", "tcp", CONFIG_METRICS_PORT);
+  LOG_I("Metrics at http://%s.local:%d/metrics", CONFIG_OTA_HOSTNAME, CONFIG_METRICS_PORT);
+  trace_end();
 
-  lv_timer_create(update_clock, 1000, NULL);
+  lv_lock();
+  lv_timer_create(STALL_TIMER(update_clock), 1000, NULL);
 
+  trace_begin("create_ui");
   lv_obj_clean(lv_scr_act());
   create_ui();
+  trace_end();
+
+  // Blocks for the whole HTTP fetch with the LVGL lock held, so the screen
+  // does not redraw until it is done; by design, as the UI has nothing to
+  // show without a forecast
+  trace_begin("first_fetch");
   fetch_and_update_weather();
+  trace_end();
+  lv_unlock();
+
+  trace_end();
+  trace_boot_done();
 }
 
 void flush_wifi_splashscreen(uint32_t ms = 200) {
@@ -582,31 +897,122 @@ void flush_wifi_splashscreen(uint32_t ms = 200) {
 }
 
 void apModeCallback(WiFiManager *mgr) {
+  lv_lock();
   wifi_splash_screen();
+  lv_unlock();
   flush_wifi_splashscreen();
 }
 
+// With LVGL running on FreeRTOS, its API may only be used while holding its
+// lock. lv_timer_handler() and the timer and event callbacks it
+// runs already hold it; anything else that changes the UI must take it with
+// lv_lock()/lv_unlock(), which nest safely.
 void loop() {
+#if CONFIG_SOAK_TEST
+  soak_loop();
+  return;
+#endif
+#if CONFIG_TRAFFIC_SIM
+  sim_loop();
+  return;
+#endif
+
+  stall_enter("ArduinoOTA.handle");
   ArduinoOTA.handle();
+  stall_exit();
+
+  stall_enter("metrics_server");
+  metrics_server.handleClient();
+  stall_exit();
+
+  poll_serial_commands();
+
+  // Its own time is redraws and LVGL's internal timers; the app's timers
+  // are stages of their own
+  stall_enter("lv_timer_handler");
+  static uint32_t last_handler_start = 0;
+  uint32_t handler_start = micros();
+  if (last_handler_start) metrics_ui_gap(handler_start - last_handler_start);
+  last_handler_start = handler_start;
   lv_timer_handler();
-  static uint32_t last = millis();
+  metrics_timer_handler(micros() - handler_start);
+  stall_exit();
 
-  if (millis() - last >= UPDATE_INTERVAL) {
-    fetch_and_update_weather();
-    last = millis();
-  }
+  poll_weather_refresh();
 
   lv_tick_inc(5);
   delay(5);
 }
 
+// Refetch the forecast every UPDATE_INTERVAL, or sooner when asked to
+static void poll_weather_refresh() {
+  static Interval schedule(UPDATE_INTERVAL, now_ms());
+
+  if (schedule.due(now_ms()) || weather_refresh_requested) {
+    weather_refresh_requested = false;
+    // The fetch blocks with the LVGL lock held, freezing the UI (clock
+    // included) until it returns. That is by design: the panels are
+    // rewritten from the new model in one go, and nothing else in the app
+    // needs the lock while the loop task waits on the network
+    lv_lock();
+    fetch_and_update_weather();
+    lv_unlock();
+    schedule.restart(now_ms());  // The next interval starts once this fetch is done
+  }
+}
+
+// The screen's vertical gradient in RGB565 is only a few dozen bands of
+// identical color, so it is computed once and drawn as plain solid fills
+// instead of having LVGL interpolate gradient rows on every redraw
+static void build_background_bands() {
+  lv_color_t top = lv_color_hex(BG_GRAD_TOP);
+  lv_color_t bottom = lv_color_hex(BG_GRAD_BOTTOM);
+  uint16_t prev = 0;
+
+  bg_band_count = 0;
+  for (int y = 0; y < SCREEN_HEIGHT; y++) {
+    lv_color_t c = lv_color_mix(bottom, top, y * 255 / (SCREEN_HEIGHT - 1));
+    uint16_t c16 = lv_color_to_u16(c);
+    if (bg_band_count > 0 && (c16 == prev || bg_band_count == MAX_BG_BANDS)) {
+      bg_bands[bg_band_count - 1].y2 = y;
+      continue;
+    }
+    bg_bands[bg_band_count++] = {(int16_t)y, (int16_t)y, c};
+    prev = c16;
+  }
+}
+
+static void screen_background_draw_cb(lv_event_t *e) {
+  lv_layer_t *layer = lv_event_get_layer(e);
+  lv_draw_rect_dsc_t dsc;
+  lv_draw_rect_dsc_init(&dsc);
+
+  // Only the bands crossing the area being redrawn, e.g. the clock's rows.
+  // LVGL 9.2 has no getter for a layer's clip area; its own widgets read
+  // _clip_area as here, and lv_draw.h documents the field. Drawing every
+  // band unclipped instead would queue a draw task per band per redraw.
+  for (int i = 0; i < bg_band_count; i++) {
+    lv_area_t band = {0, bg_bands[i].y1, SCREEN_WIDTH - 1, bg_bands[i].y2};
+    lv_area_t clipped;
+    if (!lv_area_intersect(&clipped, &band, &layer->_clip_area)) continue;
+    dsc.bg_color = bg_bands[i].color;
+    lv_draw_rect(layer, &dsc, &clipped);
+  }
+}
+
+static void set_screen_background(lv_obj_t *scr) {
+  if (bg_band_count == 0) build_background_bands();
+
+  // The screen itself stays transparent; the bands are drawn in its place
+  lv_obj_set_style_bg_opa(scr, LV_OPA_TRANSP, LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_remove_event_cb(scr, screen_background_draw_cb);
+  lv_obj_add_event_cb(scr, screen_background_draw_cb, LV_EVENT_DRAW_MAIN_BEGIN, NULL);
+}
+
 void wifi_splash_screen() {
   lv_obj_t *scr = lv_scr_act();
   lv_obj_clean(scr);
-  lv_obj_set_style_bg_color(scr, lv_color_hex(0x4c8cb9), LV_PART_MAIN | LV_STATE_DEFAULT);
-  lv_obj_set_style_bg_grad_color(scr, lv_color_hex(0xa6cdec), LV_PART_MAIN | LV_STATE_DEFAULT);
-  lv_obj_set_style_bg_grad_dir(scr, LV_GRAD_DIR_VER, LV_PART_MAIN | LV_STATE_DEFAULT);
-  lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
+  set_screen_background(scr);
 
   const LocalizedStrings* strings = get_strings(current_language);
   lv_obj_t *lbl = lv_label_create(scr);
@@ -617,24 +1023,74 @@ void wifi_splash_screen() {
   lv_scr_load(scr);
 }
 
+static void init_styles() {
+  if (styles_ready) return;
+  styles_ready = true;
+
+  lv_style_init(&style_label);
+  lv_style_set_text_color(&style_label, lv_color_hex(0xFFFFFF));
+  lv_style_set_text_opa(&style_label, LV_OPA_COVER);
+
+  lv_style_init(&style_row);
+  lv_style_set_text_color(&style_row, lv_color_hex(0xFFFFFF));
+  lv_style_set_text_opa(&style_row, LV_OPA_COVER);
+  lv_style_set_text_font(&style_row, get_font_16());
+
+  lv_style_init(&style_row_secondary);
+  lv_style_set_text_color(&style_row_secondary, lv_color_hex(0xb9ecff));
+  lv_style_set_text_font(&style_row_secondary, get_font_16());
+
+  lv_style_init(&style_caption);
+  lv_style_set_text_color(&style_caption, lv_color_hex(0xe4ffff));
+  lv_style_set_text_font(&style_caption, get_font_12());
+
+  lv_style_init(&style_header);
+  lv_style_set_text_color(&style_header, lv_color_hex(0xFFFFFF));
+  lv_style_set_text_font(&style_header, get_font_14());
+
+  lv_style_init(&style_panel);
+  lv_style_set_bg_color(&style_panel, lv_color_hex(PANEL_BG_COLOR));
+  lv_style_set_bg_opa(&style_panel, LV_OPA_COVER);
+  lv_style_set_radius(&style_panel, PANEL_RADIUS);
+  lv_style_set_border_width(&style_panel, 0);
+  lv_style_set_pad_all(&style_panel, 10);
+  lv_style_set_pad_gap(&style_panel, 0);
+}
+
+// The object and all its descendants
+static uint32_t count_objects(lv_obj_t *obj) {
+  uint32_t count = 1;
+  uint32_t children = lv_obj_get_child_count(obj);
+  for (uint32_t i = 0; i < children; i++) count += count_objects(lv_obj_get_child(obj, i));
+  return count;
+}
+
 void create_ui() {
+  // Heap the widget tree and its styles take up; LVGL allocates from the
+  // C heap (LV_STDLIB_CLIB). Also on /metrics, to compare builds
+  size_t heap_before = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  uint32_t start_us = micros();
   lv_obj_t *scr = lv_scr_act();
-  lv_obj_set_style_bg_color(scr, lv_color_hex(0x4c8cb9), LV_PART_MAIN | LV_STATE_DEFAULT);
-  lv_obj_set_style_bg_grad_color(scr, lv_color_hex(0xa6cdec), LV_PART_MAIN | LV_STATE_DEFAULT);
-  lv_obj_set_style_bg_grad_dir(scr, LV_GRAD_DIR_VER, LV_PART_MAIN | LV_STATE_DEFAULT);
-  lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
+  init_styles();
+  set_screen_background(scr);
 
   // Trigger settings screen on touch
   lv_obj_add_event_cb(scr, screen_event_cb, LV_EVENT_CLICKED, NULL);
 
   img_today_icon = lv_img_create(scr);
-  lv_img_set_src(img_today_icon, &image_partly_cloudy);
+  lv_img_set_src(img_today_icon, ASSET_IMAGE(image_partly_cloudy));
   lv_obj_align(img_today_icon, LV_ALIGN_TOP_MID, -64, 4);
 
-  static lv_style_t default_label_style;
-  lv_style_init(&default_label_style);
-  lv_style_set_text_color(&default_label_style, lv_color_hex(0xFFFFFF));
-  lv_style_set_text_opa(&default_label_style, LV_OPA_COVER);
+  // Every image is blank without the asset partition, e.g. after an OTA
+  // update from a layout without one; say so where the icon would be
+  if (!ASSET_IMAGE(image_partly_cloudy)) {
+    lv_obj_t *lbl_no_assets = lv_label_create(scr);
+    lv_label_set_text(lbl_no_assets, "Images missing:\nflash over USB\nwith make upload");
+    lv_obj_set_style_text_font(lbl_no_assets, get_font_12(), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_align(lbl_no_assets, LV_TEXT_ALIGN_CENTER, 0);
+    lv_obj_add_style(lbl_no_assets, &style_label, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_align(lbl_no_assets, LV_ALIGN_TOP_MID, -64, 30);
+  }
 
   const LocalizedStrings* strings = get_strings(current_language);
 
@@ -642,7 +1098,7 @@ void create_ui() {
   lv_label_set_text(lbl_today_temp, strings->temp_placeholder);
   lv_obj_set_style_text_font(lbl_today_temp, get_font_42(), LV_PART_MAIN | LV_STATE_DEFAULT);
   lv_obj_align(lbl_today_temp, LV_ALIGN_TOP_MID, 45, 25);
-  lv_obj_add_style(lbl_today_temp, &default_label_style, LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_add_style(lbl_today_temp, &style_label, LV_PART_MAIN | LV_STATE_DEFAULT);
 
   lbl_today_feels_like = lv_label_create(scr);
   lv_label_set_text(lbl_today_feels_like, strings->feels_like_temp);
@@ -665,127 +1121,84 @@ void create_ui() {
 
   lbl_forecast = lv_label_create(scr);
   lv_label_set_text(lbl_forecast, strings->seven_day_forecast);
-  lv_obj_set_style_text_font(lbl_forecast, get_font_12(), LV_PART_MAIN | LV_STATE_DEFAULT);
-  lv_obj_set_style_text_color(lbl_forecast, lv_color_hex(0xe4ffff), LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_add_style(lbl_forecast, &style_caption, LV_PART_MAIN | LV_STATE_DEFAULT);
   lv_obj_align(lbl_forecast, LV_ALIGN_TOP_LEFT, 20, 110);
 
+  // Name of the location on screen, only shown with several saved
+  lbl_location_name = lv_label_create(scr);
+  lv_label_set_text(lbl_location_name, "");
+  lv_label_set_long_mode(lbl_location_name, LV_LABEL_LONG_DOT);
+  lv_obj_set_width(lbl_location_name, 100);
+  lv_obj_add_style(lbl_location_name, &style_caption, LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_set_style_text_align(lbl_location_name, LV_TEXT_ALIGN_RIGHT, LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_align(lbl_location_name, LV_ALIGN_TOP_RIGHT, -20, 110);
+
   box_daily = lv_obj_create(scr);
-  lv_obj_set_size(box_daily, 220, 180);
+  lv_obj_set_size(box_daily, PANEL_WIDTH, PANEL_HEIGHT);
   lv_obj_align(box_daily, LV_ALIGN_TOP_LEFT, 10, 135);
-  lv_obj_set_style_bg_color(box_daily, lv_color_hex(0x5e9bc8), LV_PART_MAIN | LV_STATE_DEFAULT);
-  lv_obj_set_style_bg_opa(box_daily, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
-  lv_obj_set_style_radius(box_daily, 4, LV_PART_MAIN | LV_STATE_DEFAULT);
-  lv_obj_set_style_border_width(box_daily, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_add_style(box_daily, &style_panel, LV_PART_MAIN | LV_STATE_DEFAULT);
   lv_obj_clear_flag(box_daily, LV_OBJ_FLAG_SCROLLABLE);
   lv_obj_set_scrollbar_mode(box_daily, LV_SCROLLBAR_MODE_OFF);
-  lv_obj_set_style_pad_all(box_daily, 10, LV_PART_MAIN);
-  lv_obj_set_style_pad_gap(box_daily, 0, LV_PART_MAIN);
   lv_obj_add_event_cb(box_daily, daily_cb, LV_EVENT_CLICKED, NULL);
 
-  for (int i = 0; i < 7; i++) {
-    lbl_daily_day[i] = lv_label_create(box_daily);
-    lbl_daily_high[i] = lv_label_create(box_daily);
-    lbl_daily_low[i] = lv_label_create(box_daily);
-    img_daily[i] = lv_img_create(box_daily);
-
-    lv_obj_add_style(lbl_daily_day[i], &default_label_style, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(lbl_daily_day[i], get_font_16(), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_align(lbl_daily_day[i], LV_ALIGN_TOP_LEFT, 2, i * 24);
-
-    lv_obj_add_style(lbl_daily_high[i], &default_label_style, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(lbl_daily_high[i], get_font_16(), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_align(lbl_daily_high[i], LV_ALIGN_TOP_RIGHT, 0, i * 24);
-
-    lv_label_set_text(lbl_daily_low[i], "");
-    lv_obj_set_style_text_color(lbl_daily_low[i], lv_color_hex(0xb9ecff), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(lbl_daily_low[i], get_font_16(), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_align(lbl_daily_low[i], LV_ALIGN_TOP_RIGHT, -50, i * 24);
-
-    lv_img_set_src(img_daily[i], &icon_partly_cloudy);
-    lv_obj_align(img_daily[i], LV_ALIGN_TOP_LEFT, 72, i * 24);
-  }
+  lv_obj_add_style(box_daily, &style_row, LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_add_style(box_daily, &style_row_secondary, LV_PART_ITEMS | LV_STATE_DEFAULT);
+  forecast_table_attach(box_daily, &daily_table, 50);
 
   box_hourly = lv_obj_create(scr);
-  lv_obj_set_size(box_hourly, 220, 180);
+  lv_obj_set_size(box_hourly, PANEL_WIDTH, PANEL_HEIGHT);
   lv_obj_align(box_hourly, LV_ALIGN_TOP_LEFT, 10, 135);
-  lv_obj_set_style_bg_color(box_hourly, lv_color_hex(0x5e9bc8), LV_PART_MAIN | LV_STATE_DEFAULT);
-  lv_obj_set_style_bg_opa(box_hourly, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
-  lv_obj_set_style_radius(box_hourly, 4, LV_PART_MAIN | LV_STATE_DEFAULT);
-  lv_obj_set_style_border_width(box_hourly, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_add_style(box_hourly, &style_panel, LV_PART_MAIN | LV_STATE_DEFAULT);
   lv_obj_clear_flag(box_hourly, LV_OBJ_FLAG_SCROLLABLE);
   lv_obj_set_scrollbar_mode(box_hourly, LV_SCROLLBAR_MODE_OFF);
-  lv_obj_set_style_pad_all(box_hourly, 10, LV_PART_MAIN);
-  lv_obj_set_style_pad_gap(box_hourly, 0, LV_PART_MAIN);
   lv_obj_add_event_cb(box_hourly, hourly_cb, LV_EVENT_CLICKED, NULL);
 
-  for (int i = 0; i < 7; i++) {
-    lbl_hourly[i] = lv_label_create(box_hourly);
-    lbl_precipitation_probability[i] = lv_label_create(box_hourly);
-    lbl_hourly_temp[i] = lv_label_create(box_hourly);
-    img_hourly[i] = lv_img_create(box_hourly);
-
-    lv_obj_add_style(lbl_hourly[i], &default_label_style, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(lbl_hourly[i], get_font_16(), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_align(lbl_hourly[i], LV_ALIGN_TOP_LEFT, 2, i * 24);
+  lv_obj_add_style(box_hourly, &style_row, LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_add_style(box_hourly, &style_row_secondary, LV_PART_ITEMS | LV_STATE_DEFAULT);
+  forecast_table_attach(box_hourly, &hourly_table, 55);
 
-    lv_obj_add_style(lbl_hourly_temp[i], &default_label_style, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(lbl_hourly_temp[i], get_font_16(), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_align(lbl_hourly_temp[i], LV_ALIGN_TOP_RIGHT, 0, i * 24);
-
-    lv_label_set_text(lbl_precipitation_probability[i], "");
-    lv_obj_set_style_text_color(lbl_precipitation_probability[i], lv_color_hex(0xb9ecff), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(lbl_precipitation_probability[i], get_font_16(), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_align(lbl_precipitation_probability[i], LV_ALIGN_TOP_RIGHT, -55, i * 24);
-
-    lv_img_set_src(img_hourly[i], &icon_partly_cloudy);
-    lv_obj_align(img_hourly[i], LV_ALIGN_TOP_LEFT, 72, i * 24);
+  for (int i = 0; i < FORECAST_TABLE_ROWS; i++) {
+    forecast_table_set_row(box_daily, i, "", PANEL_ICON(icon_partly_cloudy), "", "");
+    forecast_table_set_row(box_hourly, i, "", PANEL_ICON(icon_partly_cloudy), "", "");
   }
 
   lv_obj_add_flag(box_hourly, LV_OBJ_FLAG_HIDDEN);
 
   // Create transit panel (TfL bus and tube arrivals)
   box_transit = lv_obj_create(scr);
-  lv_obj_set_size(box_transit, 220, 180);
+  lv_obj_set_size(box_transit, PANEL_WIDTH, PANEL_HEIGHT);
   lv_obj_align(box_transit, LV_ALIGN_TOP_LEFT, 10, 135);
-  lv_obj_set_style_bg_color(box_transit, lv_color_hex(0x5e9bc8), LV_PART_MAIN | LV_STATE_DEFAULT);
-  lv_obj_set_style_bg_opa(box_transit, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
-  lv_obj_set_style_radius(box_transit, 4, LV_PART_MAIN | LV_STATE_DEFAULT);
-  lv_obj_set_style_border_width(box_transit, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_add_style(box_transit, &style_panel, LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_set_style_pad_all(box_transit, 8, LV_PART_MAIN);
   lv_obj_clear_flag(box_transit, LV_OBJ_FLAG_SCROLLABLE);
   lv_obj_set_scrollbar_mode(box_transit, LV_SCROLLBAR_MODE_OFF);
-  lv_obj_set_style_pad_all(box_transit, 8, LV_PART_MAIN);
-  lv_obj_set_style_pad_gap(box_transit, 0, LV_PART_MAIN);
   lv_obj_add_event_cb(box_transit, transit_cb, LV_EVENT_CLICKED, NULL);
 
   // Bus section header
   lbl_bus_header = lv_label_create(box_transit);
   lv_label_set_text(lbl_bus_header, strings->bus_stop_label);
-  lv_obj_set_style_text_font(lbl_bus_header, get_font_14(), LV_PART_MAIN | LV_STATE_DEFAULT);
-  lv_obj_set_style_text_color(lbl_bus_header, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_add_style(lbl_bus_header, &style_header, LV_PART_MAIN | LV_STATE_DEFAULT);
   lv_obj_align(lbl_bus_header, LV_ALIGN_TOP_LEFT, 0, 0);
 
   // Bus arrival labels
   for (int i = 0; i < 4; i++) {
     lbl_bus_arrivals[i] = lv_label_create(box_transit);
     lv_label_set_text(lbl_bus_arrivals[i], "");
-    lv_obj_set_style_text_font(lbl_bus_arrivals[i], get_font_12(), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_color(lbl_bus_arrivals[i], lv_color_hex(0xe4ffff), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(lbl_bus_arrivals[i], &style_caption, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_align(lbl_bus_arrivals[i], LV_ALIGN_TOP_LEFT, 0, 18 + i * 16);
   }
 
   // Tube section header
   lbl_tube_header = lv_label_create(box_transit);
   lv_label_set_text(lbl_tube_header, strings->tube_station_label);
-  lv_obj_set_style_text_font(lbl_tube_header, get_font_14(), LV_PART_MAIN | LV_STATE_DEFAULT);
-  lv_obj_set_style_text_color(lbl_tube_header, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_add_style(lbl_tube_header, &style_header, LV_PART_MAIN | LV_STATE_DEFAULT);
   lv_obj_align(lbl_tube_header, LV_ALIGN_TOP_LEFT, 0, 88);
 
   // Tube arrival labels
   for (int i = 0; i < 4; i++) {
     lbl_tube_arrivals[i] = lv_label_create(box_transit);
     lv_label_set_text(lbl_tube_arrivals[i], "");
-    lv_obj_set_style_text_font(lbl_tube_arrivals[i], get_font_12(), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_color(lbl_tube_arrivals[i], lv_color_hex(0xe4ffff), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_style(lbl_tube_arrivals[i], &style_caption, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_align(lbl_tube_arrivals[i], LV_ALIGN_TOP_LEFT, 0, 106 + i * 16);
   }
 
@@ -799,80 +1212,162 @@ void create_ui() {
   lv_obj_align(lbl_clock, LV_ALIGN_TOP_RIGHT, -10, 2);
 
   // Start auto-rotation if enabled
-  current_panel = 0;  // Reset to daily panel
+  // New widgets are empty until rendered
+  current_panel = PANEL_DAILY;
+  for (int i = 0; i < PANEL_COUNT; i++) panel_dirty[i] = true;
   if (auto_rotate_enabled) {
     start_auto_rotation();
   }
 
+  // Cycle through saved locations if there are several
+  update_location_rotation();
+
   // Start transit refresh timer if transit is enabled
   if (transit_enabled) {
     if (transit_refresh_timer) {
       lv_timer_del(transit_refresh_timer);
     }
-    transit_refresh_timer = lv_timer_create(transit_refresh_callback, TRANSIT_REFRESH_INTERVAL, NULL);
-    Serial.println("Transit refresh timer started (5 second interval)");
+    transit_refresh_timer = lv_timer_create(STALL_TIMER(transit_refresh_callback), TRANSIT_REFRESH_INTERVAL, NULL);
+    LOG_I("Transit refresh timer started (5 second interval)");
   }
+
+  main_screen_heap = heap_before - heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  LOG_I("Main screen: %u objects, %u bytes of heap, created in %u us", (unsigned)count_objects(scr),
+        (unsigned)main_screen_heap, (unsigned)(micros() - start_us));
+}
+
+// Append src to buf at len, never writing past size; returns the new length
+static size_t append_bounded(char *buf, size_t len, size_t size, const char *src) {
+  while (*src && len + 1 < size) {
+    buf[len++] = *src++;
+  }
+  buf[len] = '\0';
+  return len;
 }
 
 void populate_results_dropdown() {
+  char *dd_opts = geo_arena->dd_opts;
+  size_t len = 0;
   dd_opts[0] = '\0';
-  for (JsonObject item : geoResults) {
-    strcat(dd_opts, item["name"].as<const char *>());
-    if (item["admin1"]) {
-      strcat(dd_opts, ", ");
-      strcat(dd_opts, item["admin1"].as<const char *>());
-    }
 
-    strcat(dd_opts, "\n");
+  // One line per result; stop at the first one that does not fit so the
+  // dropdown index keeps matching geo_results
+  int shown = 0;
+  for (int i = 0; i < geo_result_count; i++) {
+    size_t needed = (i > 0) + strlen(geo_results[i].name);
+    if (geo_results[i].admin1) needed += 2 + strlen(geo_results[i].admin1);
+    if (len + needed >= sizeof(geo_arena->dd_opts)) break;
+
+    if (i > 0) len = append_bounded(dd_opts, len, sizeof(geo_arena->dd_opts), "\n");
+    len = append_bounded(dd_opts, len, sizeof(geo_arena->dd_opts), geo_results[i].name);
+    if (geo_results[i].admin1) {
+      len = append_bounded(dd_opts, len, sizeof(geo_arena->dd_opts), ", ");
+      len = append_bounded(dd_opts, len, sizeof(geo_arena->dd_opts), geo_results[i].admin1);
+    }
+    shown++;
   }
+  geo_result_count = shown;
 
-  if (geoResults.size() > 0) {
+  if (geo_result_count > 0) {
     lv_dropdown_set_options_static(results_dd, dd_opts);
     lv_obj_add_flag(results_dd, LV_OBJ_FLAG_CLICKABLE);
     lv_obj_set_style_bg_color(btn_close_loc, lv_palette_main(LV_PALETTE_GREEN), LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_bg_opa(btn_close_loc, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_bg_color(btn_close_loc, lv_palette_darken(LV_PALETTE_GREEN, 1), LV_PART_MAIN | LV_STATE_PRESSED);
     lv_obj_add_flag(btn_close_loc, LV_OBJ_FLAG_CLICKABLE);
+  } else {
+    lv_dropdown_set_options(results_dd, "");
+    lv_obj_clear_flag(results_dd, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_set_style_bg_color(btn_close_loc, lv_palette_main(LV_PALETTE_GREY), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_color(btn_close_loc, lv_palette_darken(LV_PALETTE_GREY, 1), LV_PART_MAIN | LV_STATE_PRESSED);
+    lv_obj_clear_flag(btn_close_loc, LV_OBJ_FLAG_CLICKABLE);
   }
 }
 
-static void location_save_event_cb(lv_event_t *e) {
-  JsonArray *pres = static_cast<JsonArray *>(lv_event_get_user_data(e));
-  uint16_t idx = lv_dropdown_get_selected(results_dd);
+// Format a coordinate in 1e-5 degrees as a decimal string, e.g. -12574 -> "-0.12574"
+static void format_coordinate(char *buf, size_t len, int32_t e5) {
+  uint32_t mag = (e5 < 0) ? (uint32_t)(-(int64_t)e5) : (uint32_t)e5;
+  snprintf(buf, len, "%s%lu.%05lu", (e5 < 0) ? "-" : "",
+           (unsigned long)(mag / 100000), (unsigned long)(mag % 100000));
+}
 
-  JsonObject obj = (*pres)[idx];
-  double lat = obj["latitude"].as<double>();
-  double lon = obj["longitude"].as<double>();
+// Home location in the settings window, with a count of any others
+static void update_location_label() {
+  if (location_count > 1) {
+    lv_label_set_text_fmt(lbl_loc, "%s +%d", locations[0].name, location_count - 1);
+  } else {
+    lv_label_set_text(lbl_loc, locations[0].name);
+  }
+}
 
-  snprintf(latitude, sizeof(latitude), "%.6f", lat);
-  snprintf(longitude, sizeof(longitude), "%.6f", lon);
-  prefs.putString("latitude", latitude);
-  prefs.putString("longitude", longitude);
+static void location_save_event_cb(lv_event_t *e) {
+  uint16_t idx = lv_dropdown_get_selected(results_dd);
+  if (idx >= geo_result_count) return;
 
-  String opts;
-  const char *name = obj["name"];
-  const char *admin = obj["admin1"];
-  const char *country = obj["country_code"];
-  opts += name;
-  if (admin) {
-    opts += ", ";
-    opts += admin;
+  // Saving into the free slot after the last location adds a new one
+  int slot = edit_location;
+  if (slot >= location_count) {
+    slot = location_count++;
   }
 
-  prefs.putString("location", opts);
-  location = prefs.getString("location");
+  const GeoResult &result = geo_results[idx];
+  SavedLocation &loc = locations[slot];
+  format_coordinate(loc.latitude, sizeof(loc.latitude), result.lat_e5);
+  format_coordinate(loc.longitude, sizeof(loc.longitude), result.lon_e5);
+  if (result.admin1) {
+    snprintf(loc.name, sizeof(loc.name), "%s, %s", result.name, result.admin1);
+  } else {
+    snprintf(loc.name, sizeof(loc.name), "%s", result.name);
+  }
+  weather[slot].valid = false;
+  save_locations();
 
   // Re‐fetch weather immediately
-  lv_label_set_text(lbl_loc, opts.c_str());
+  update_location_label();
+  current_location = slot;
+  update_location_rotation();
   fetch_and_update_weather();
 
   lv_obj_del(location_win);
-  location_win = nullptr;
+}
+
+static void location_remove_event_cb(lv_event_t *e) {
+  int slot = edit_location;
+  if (slot == 0 || slot >= location_count) return;
+
+  for (int i = slot; i < location_count - 1; i++) {
+    locations[i] = locations[i + 1];
+    weather[i] = weather[i + 1];
+  }
+  location_count--;
+  save_locations();
+  update_location_label();
+
+  current_location = 0;
+  update_location_rotation();
+  render_weather();
+
+  lv_obj_del(location_win);
+}
+
+static void slot_dd_changed_cb(lv_event_t *e) {
+  edit_location = lv_dropdown_get_selected(slot_dd);
 }
 
 static void location_cancel_event_cb(lv_event_t *e) {
   lv_obj_del(location_win);
+}
+
+// Release the search arena however the location window goes away
+static void location_win_delete_cb(lv_event_t *e) {
+  lv_timer_del(geo_debounce_timer);
+  geo_debounce_timer = nullptr;
+  free(geo_arena);
+  geo_arena = nullptr;
+  geo_results = nullptr;
+  geo_result_count = 0;
   location_win = nullptr;
+  slot_dd = nullptr;
 }
 
 void screen_event_cb(lv_event_t *e) {
@@ -880,32 +1375,16 @@ void screen_event_cb(lv_event_t *e) {
 }
 
 void daily_cb(lv_event_t *e) {
-  const LocalizedStrings* strings = get_strings(current_language);
-  lv_obj_add_flag(box_daily, LV_OBJ_FLAG_HIDDEN);
-  lv_label_set_text(lbl_forecast, strings->hourly_forecast);
-  lv_obj_clear_flag(box_hourly, LV_OBJ_FLAG_HIDDEN);
+  show_panel(PANEL_HOURLY);
 }
 
 void hourly_cb(lv_event_t *e) {
-  const LocalizedStrings* strings = get_strings(current_language);
-  lv_obj_add_flag(box_hourly, LV_OBJ_FLAG_HIDDEN);
-  
   // If transit is enabled, show transit panel, otherwise go back to daily
-  if (transit_enabled) {
-    lv_label_set_text(lbl_forecast, strings->transit_title);
-    lv_obj_clear_flag(box_transit, LV_OBJ_FLAG_HIDDEN);
-    fetch_tfl_arrivals();  // Refresh transit data when viewing
-  } else {
-    lv_label_set_text(lbl_forecast, strings->seven_day_forecast);
-    lv_obj_clear_flag(box_daily, LV_OBJ_FLAG_HIDDEN);
-  }
+  show_panel(transit_enabled ? PANEL_TRANSIT : PANEL_DAILY);
 }
 
 void transit_cb(lv_event_t *e) {
-  const LocalizedStrings* strings = get_strings(current_language);
-  lv_obj_add_flag(box_transit, LV_OBJ_FLAG_HIDDEN);
-  lv_label_set_text(lbl_forecast, strings->seven_day_forecast);
-  lv_obj_clear_flag(box_daily, LV_OBJ_FLAG_HIDDEN);
+  show_panel(PANEL_DAILY);
 }
 
 
@@ -943,9 +1422,10 @@ static void reset_wifi_event_handler(lv_event_t *e) {
 
 static void reset_confirm_yes_cb(lv_event_t *e) {
   lv_obj_t *mbox = (lv_obj_t *)lv_event_get_user_data(e);
-  Serial.println("Clearing Wi-Fi creds and rebooting");
+  LOG_I("Clearing Wi-Fi creds and rebooting");
   WiFiManager wm;
   wm.resetSettings();
+  log_flush(500);
   delay(100);
   esp_restart();
 }
@@ -973,10 +1453,7 @@ static void transit_save_event_cb(lv_event_t *e) {
     snprintf(key, sizeof(key), "busStopId%d", i + 1);
     prefs.putString(key, bus_stop_ids[i]);
     
-    Serial.print("Saved bus stop ID ");
-    Serial.print(i + 1);
-    Serial.print(": ");
-    Serial.println(bus_stop_ids[i]);
+    LOG_I("Saved bus stop ID %d: %s", i + 1, bus_stop_ids[i]);
   }
   
   strncpy(tube_station_id, tube_id, sizeof(tube_station_id) - 1);
@@ -984,8 +1461,7 @@ static void transit_save_event_cb(lv_event_t *e) {
   
   transit_enabled = (any_bus_stop_configured() || strlen(tube_station_id) > 0);
   
-  Serial.print("Saved tube station ID: ");
-  Serial.println(tube_station_id);
+  LOG_I("Saved tube station ID: %s", tube_station_id);
   
   lv_obj_del(transit_settings_win);
   transit_settings_win = nullptr;
@@ -994,14 +1470,14 @@ static void transit_save_event_cb(lv_event_t *e) {
   if (transit_enabled) {
     fetch_tfl_arrivals();
     if (!transit_refresh_timer) {
-      transit_refresh_timer = lv_timer_create(transit_refresh_callback, TRANSIT_REFRESH_INTERVAL, NULL);
-      Serial.println("Transit refresh timer started");
+      transit_refresh_timer = lv_timer_create(STALL_TIMER(transit_refresh_callback), TRANSIT_REFRESH_INTERVAL, NULL);
+      LOG_I("Transit refresh timer started");
     }
   } else {
     if (transit_refresh_timer) {
       lv_timer_del(transit_refresh_timer);
       transit_refresh_timer = nullptr;
-      Serial.println("Transit refresh timer stopped");
+      LOG_I("Transit refresh timer stopped");
     }
   }
 }
@@ -1101,8 +1577,19 @@ void create_transit_settings_dialog() {
 }
 
 void create_location_dialog() {
+  geo_arena = (GeoSearchArena *)calloc(1, sizeof(GeoSearchArena));
+  if (!geo_arena) {
+    LOG_E("Not enough memory for location search");
+    return;
+  }
+  geo_results = nullptr;
+  geo_result_count = 0;
+  geo_debounce_timer = lv_timer_create(STALL_TIMER(geo_debounce_cb), GEO_DEBOUNCE_MS, NULL);
+  lv_timer_pause(geo_debounce_timer);
+
   const LocalizedStrings* strings = get_strings(current_language);
   location_win = lv_win_create(lv_scr_act());
+  lv_obj_add_event_cb(location_win, location_win_delete_cb, LV_EVENT_DELETE, NULL);
   lv_obj_t *title = lv_win_add_title(location_win, strings->change_location);
   lv_obj_t *header = lv_win_get_header(location_win);
   lv_obj_set_style_height(header, 30, 0);
@@ -1126,6 +1613,7 @@ void create_location_dialog() {
 
   lv_obj_add_event_cb(loc_ta, ta_event_cb, LV_EVENT_CLICKED, kb);
   lv_obj_add_event_cb(loc_ta, ta_defocus_cb, LV_EVENT_DEFOCUSED, kb);
+  lv_obj_add_event_cb(loc_ta, loc_ta_changed_cb, LV_EVENT_VALUE_CHANGED, NULL);
 
   lv_obj_t *lbl2 = lv_label_create(cont);
   lv_label_set_text(lbl2, strings->search_results);
@@ -1144,11 +1632,50 @@ void create_location_dialog() {
   lv_dropdown_set_options(results_dd, "");
   lv_obj_clear_flag(results_dd, LV_OBJ_FLAG_CLICKABLE);
 
+  // Which saved location to replace, plus one free slot to add a new one
+  lv_obj_t *lbl3 = lv_label_create(cont);
+  lv_label_set_text(lbl3, strings->location);
+  lv_obj_set_style_text_font(lbl3, get_font_14(), LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_align(lbl3, LV_ALIGN_TOP_LEFT, 5, 120);
+
+  char slot_opts[MAX_LOCATIONS * 72] = "";
+  size_t slot_len = 0;
+  int slots = (location_count < MAX_LOCATIONS) ? location_count + 1 : MAX_LOCATIONS;
+  for (int i = 0; i < slots; i++) {
+    slot_len += snprintf(slot_opts + slot_len, sizeof(slot_opts) - slot_len, "%s%d. %s",
+                         i ? "\n" : "", i + 1, (i < location_count) ? locations[i].name : "-");
+    if (slot_len >= sizeof(slot_opts)) break;
+  }
+
+  slot_dd = lv_dropdown_create(cont);
+  lv_dropdown_set_options(slot_dd, slot_opts);
+  lv_dropdown_set_selected(slot_dd, current_location);
+  edit_location = current_location;
+  lv_obj_set_width(slot_dd, 130);
+  lv_obj_set_style_text_font(slot_dd, get_font_14(), LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_set_style_text_font(lv_dropdown_get_list(slot_dd), get_font_14(), LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_align_to(slot_dd, lbl3, LV_ALIGN_OUT_RIGHT_MID, 5, 0);
+  lv_obj_add_event_cb(slot_dd, slot_dd_changed_cb, LV_EVENT_VALUE_CHANGED, NULL);
+
+  if (location_count > 1) {
+    lv_obj_t *btn_remove = lv_btn_create(cont);
+    lv_obj_set_size(btn_remove, 80, 30);
+    lv_obj_align(btn_remove, LV_ALIGN_TOP_RIGHT, -5, 160);
+    lv_obj_set_style_bg_color(btn_remove, lv_palette_main(LV_PALETTE_RED), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_color(btn_remove, lv_palette_darken(LV_PALETTE_RED, 1), LV_PART_MAIN | LV_STATE_PRESSED);
+    lv_obj_add_event_cb(btn_remove, location_remove_event_cb, LV_EVENT_CLICKED, NULL);
+
+    lv_obj_t *lbl_remove = lv_label_create(btn_remove);
+    lv_label_set_text(lbl_remove, strings->remove);
+    lv_obj_set_style_text_font(lbl_remove, get_font_12(), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_center(lbl_remove);
+  }
+
   btn_close_loc = lv_btn_create(cont);
   lv_obj_set_size(btn_close_loc, 80, 40);
   lv_obj_align(btn_close_loc, LV_ALIGN_BOTTOM_RIGHT, 0, 0);
 
-  lv_obj_add_event_cb(btn_close_loc, location_save_event_cb, LV_EVENT_CLICKED, &geoResults);
+  lv_obj_add_event_cb(btn_close_loc, location_save_event_cb, LV_EVENT_CLICKED, NULL);
   lv_obj_set_style_bg_color(btn_close_loc, lv_palette_main(LV_PALETTE_GREY), LV_PART_MAIN | LV_STATE_DEFAULT);
   lv_obj_set_style_bg_opa(btn_close_loc, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
   lv_obj_set_style_bg_color(btn_close_loc, lv_palette_darken(LV_PALETTE_GREY, 1), LV_PART_MAIN | LV_STATE_PRESSED);
@@ -1162,7 +1689,7 @@ void create_location_dialog() {
   lv_obj_t *btn_cancel_loc = lv_btn_create(cont);
   lv_obj_set_size(btn_cancel_loc, 80, 40);
   lv_obj_align_to(btn_cancel_loc, btn_close_loc, LV_ALIGN_OUT_LEFT_MID, -5, 0);
-  lv_obj_add_event_cb(btn_cancel_loc, location_cancel_event_cb, LV_EVENT_CLICKED, &geoResults);
+  lv_obj_add_event_cb(btn_cancel_loc, location_cancel_event_cb, LV_EVENT_CLICKED, NULL);
 
   lv_obj_t *lbl_cancel = lv_label_create(btn_cancel_loc);
   lv_label_set_text(lbl_cancel, strings->cancel);
@@ -1276,7 +1803,7 @@ void create_settings_window() {
   lv_obj_align_to(lbl_loc_l, lbl_u, LV_ALIGN_OUT_BOTTOM_LEFT, 0, vertical_element_spacing);
 
   lbl_loc = lv_label_create(cont);
-  lv_label_set_text(lbl_loc, location.c_str());
+  update_location_label();
   lv_obj_set_style_text_font(lbl_loc, get_font_12(), LV_PART_MAIN | LV_STATE_DEFAULT);
   lv_obj_align_to(lbl_loc, lbl_loc_l, LV_ALIGN_OUT_RIGHT_MID, 5, 0);
 
@@ -1428,7 +1955,7 @@ static void settings_event_handler(lv_event_t *e) {
 // Screen dimming functions implementation
 bool night_mode_should_be_active() {
   struct tm timeinfo;
-  if (!getLocalTime(&timeinfo)) return false;
+  if (!local_time(&timeinfo)) return false;
 
   if (!use_night_mode) return false;
   
@@ -1473,35 +2000,11 @@ void handle_temp_screen_wakeup_timeout(lv_timer_t *timer) {
 
 // Auto-rotation functions implementation
 void rotate_to_next_panel() {
-  const LocalizedStrings* strings = get_strings(current_language);
-  
   // Determine how many panels are available
   int max_panels = transit_enabled ? 3 : 2;
   
   // Move to the next panel
-  current_panel = (current_panel + 1) % max_panels;
-  
-  // Hide all panels first
-  lv_obj_add_flag(box_daily, LV_OBJ_FLAG_HIDDEN);
-  lv_obj_add_flag(box_hourly, LV_OBJ_FLAG_HIDDEN);
-  lv_obj_add_flag(box_transit, LV_OBJ_FLAG_HIDDEN);
-  
-  // Show the appropriate panel
-  switch (current_panel) {
-    case 0:
-      lv_label_set_text(lbl_forecast, strings->seven_day_forecast);
-      lv_obj_clear_flag(box_daily, LV_OBJ_FLAG_HIDDEN);
-      break;
-    case 1:
-      lv_label_set_text(lbl_forecast, strings->hourly_forecast);
-      lv_obj_clear_flag(box_hourly, LV_OBJ_FLAG_HIDDEN);
-      break;
-    case 2:
-      lv_label_set_text(lbl_forecast, strings->transit_title);
-      lv_obj_clear_flag(box_transit, LV_OBJ_FLAG_HIDDEN);
-      fetch_tfl_arrivals();  // Refresh transit data when viewing
-      break;
-  }
+  show_panel((current_panel + 1) % max_panels);
 }
 
 void auto_rotate_callback(lv_timer_t *timer) {
@@ -1512,9 +2015,8 @@ void start_auto_rotation() {
   if (auto_rotate_timer) {
     lv_timer_del(auto_rotate_timer);
   }
-  auto_rotate_timer = lv_timer_create(auto_rotate_callback, auto_rotate_interval, NULL);
-  Serial.print("Auto-rotation started with interval: ");
-  Serial.println(auto_rotate_interval);
+  auto_rotate_timer = lv_timer_create(STALL_TIMER(auto_rotate_callback), auto_rotate_interval, NULL);
+  LOG_I("Auto-rotation started with interval: %lu", (unsigned long)auto_rotate_interval);
 }
 
 void stop_auto_rotation() {
@@ -1522,199 +2024,619 @@ void stop_auto_rotation() {
     lv_timer_del(auto_rotate_timer);
     auto_rotate_timer = nullptr;
   }
-  Serial.println("Auto-rotation stopped");
+  LOG_I("Auto-rotation stopped");
+}
+
+static const GeoCacheEntry *geo_cache_lookup(const char *q) {
+  for (int i = 0; i < GEO_CACHE_ENTRIES; i++) {
+    GeoCacheEntry *entry = &geo_arena->cache[i];
+    if (entry->last_used && strcmp(entry->query, q) == 0) {
+      entry->last_used = ++geo_arena->cache_clock;
+      return entry;
+    }
+  }
+  return nullptr;
+}
+
+static GeoCacheEntry *geo_cache_evict() {
+  GeoCacheEntry *oldest = &geo_arena->cache[0];
+  for (int i = 1; i < GEO_CACHE_ENTRIES; i++) {
+    if (geo_arena->cache[i].last_used < oldest->last_used) {
+      oldest = &geo_arena->cache[i];
+    }
+  }
+  memset(oldest, 0, sizeof(*oldest));
+  return oldest;
+}
+
+// Copy src into the entry's text buffer; nullptr once the buffer is full
+static const char *geo_cache_store(GeoCacheEntry *entry, size_t *used, const char *src) {
+  size_t len = strlen(src) + 1;
+  if (*used + len > sizeof(entry->text)) return nullptr;
+  char *dst = entry->text + *used;
+  memcpy(dst, src, len);
+  *used += len;
+  return dst;
+}
+
+void run_location_search(const char *q, bool allow_online) {
+  if (!geo_arena) return;
+
+  geo_results = geo_arena->index_results;
+  geo_result_count = 0;
+
+  if (strlen(q) > 0) {
+    const CityRecord *cities[MAX_GEO_RESULTS];
+    size_t count = city_index_search(q, cities, MAX_GEO_RESULTS);
+    for (size_t i = 0; i < count; i++) {
+      geo_arena->index_results[i].name = city_name(cities[i]);
+      geo_arena->index_results[i].admin1 = city_admin1(cities[i]);
+      geo_arena->index_results[i].lat_e5 = cities[i]->lat_e5;
+      geo_arena->index_results[i].lon_e5 = cities[i]->lon_e5;
+    }
+    geo_result_count = count;
+
+    // Fall back to the online geocoding API for places not in the offline index
+    if (count == 0 && allow_online && strlen(q) < GEO_QUERY_MAX) {
+      const GeoCacheEntry *entry = geo_cache_lookup(q);
+      if (!entry) entry = do_geocode_query(q);
+      if (entry) {
+        geo_results = entry->results;
+        geo_result_count = entry->count;
+      }
+    }
+  }
+
+  populate_results_dropdown();
 }
 
-void do_geocode_query(const char *q) {
-  geoDoc.clear();
-  String url = String("https://geocoding-api.open-meteo.com/v1/search?name=") + urlencode(q) + "&count=15";
+const GeoCacheEntry *do_geocode_query(const char *q) {
+  StallScope stall("do_geocode_query");
+  TraceScope trace("do_geocode_query");
+  ArenaScope scratch(refresh_arena);  // Outlives the JSON documents below
+  GeoCacheEntry *entry = nullptr;
+  StackStr<160> url;  // Room for a GEO_QUERY_MAX query that is all escapes
+  url.add(GEOCODE_URL "?name=").add_urlencoded(q).add("&count=15");
+  uint32_t fetch_start = millis();
 
   HTTPClient http;
-  http.begin(url);
-  if (http.GET() == HTTP_CODE_OK) {
-    Serial.println("Completed location search at open-meteo: " + url);
-    auto err = deserializeJson(geoDoc, http.getString());
+  http.useHTTP10(true);  // No chunked encoding, so the body can be parsed from the stream
+  http.begin(url.c_str());
+  int code = http.GET();
+  if (code == HTTP_CODE_OK) {
+    LOG_I("Completed location search at open-meteo: %s", url.c_str());
+
+    // Only keep the fields the result list needs
+    JsonDocument filter(&refresh_json_allocator);
+    filter["results"][0]["name"] = true;
+    filter["results"][0]["admin1"] = true;
+    filter["results"][0]["latitude"] = true;
+    filter["results"][0]["longitude"] = true;
+
+    JsonDocument doc(&refresh_json_allocator);
+    trace_begin("deserializeJson");
+    auto err = deserializeJson(doc, http.getStream(), DeserializationOption::Filter(filter));
+    trace_end();
     if (!err) {
-      geoResults = geoDoc["results"].as<JsonArray>();
-      populate_results_dropdown();
+      entry = geo_cache_evict();
+      strcpy(entry->query, q);
+      entry->last_used = ++geo_arena->cache_clock;
+
+      size_t used = 0;
+      for (JsonObject item : doc["results"].as<JsonArray>()) {
+        if (entry->count == MAX_GEO_RESULTS) break;
+        const char *admin1 = item["admin1"];
+        GeoResult &result = entry->results[entry->count];
+        result.name = geo_cache_store(entry, &used, item["name"] | "?");
+        result.admin1 = admin1 ? geo_cache_store(entry, &used, admin1) : nullptr;
+        if (!result.name) break;
+        result.lat_e5 = lround(item["latitude"].as<double>() * 100000.0);
+        result.lon_e5 = lround(item["longitude"].as<double>() * 100000.0);
+        entry->count++;
+      }
     } else {
-        Serial.println("Failed to parse search response from open-meteo: " + url);
+        LOG_W("Failed to parse search response from open-meteo: %s", url.c_str());
     }
   } else {
-      Serial.println("Failed location search at open-meteo: " + url);
+      LOG_W("Failed location search at open-meteo: %s", url.c_str());
   }
+  int body_size = http.getSize();  // -1 if the server sent no length
   http.end();
+  traffic_record(url.c_str(), traffic_request_bytes(url.c_str()), body_size > 0 ? body_size : 0,
+                 code == HTTP_CODE_OK);
+  metrics_fetch(METRICS_FETCH_GEOCODE, millis() - fetch_start, entry != nullptr);
+  return entry;
+}
+
+// Feed a response body to a streaming parser in small chunks until the
+// parser has seen the whole document, the body ends or the server stalls.
+// Returns the bytes read.
+template <typename Parser>
+static size_t stream_body(HTTPClient &http, Parser &parser) {
+  TraceScope trace("stream_body");
+  WiFiClient *stream = http.getStreamPtr();
+  int remaining = http.getSize();  // -1 if the server sent no length
+  char buf[256];
+  size_t received = 0;
+  uint32_t last_data = millis();
+
+  while (http.connected() && (remaining > 0 || remaining == -1) && !parser.complete()) {
+    size_t available = stream->available();
+    if (available) {
+      int n = stream->readBytes(buf, min(available, sizeof(buf)));
+      parser.feed(buf, n);
+      received += n;
+      if (remaining > 0) remaining -= n;
+      last_data = millis();
+    } else if (millis() - last_data > HTTP_READ_TIMEOUT) {
+      break;
+    } else {
+      delay(1);
+    }
+  }
+  return received;
+}
+
+#if CONFIG_TRAFFIC_SIM
+// Stub endpoints: a synthetic body of the right shape for the forecast and
+// TfL arrivals, nothing for anything else. Returns the body length.
+static size_t sim_response(const char *url, char *body, size_t size) {
+  static uint32_t seed = 0;
+  seed++;
+  if (strstr(url, "/v1/forecast?")) {
+    return soak_forecast_json(body, size, location_count, seed, SIM_EPOCH + sim_ms / 1000);
+  }
+  if (strstr(url, "/StopPoint/")) {
+    return soak_arrivals_json(body, size, SIM_ARRIVALS, seed);
+  }
+  return 0;
+}
+#endif
+
+// GET url and stream the body through parser, counting the request against
+// its host. Returns the HTTP status, or a negative HTTPClient error.
+template <typename Parser>
+static int http_stream(const char *url, Parser &parser) {
+#if CONFIG_TRAFFIC_SIM
+  char *body = (char *)refresh_arena.alloc(SIM_BODY_MAX);
+  size_t len = body ? sim_response(url, body, SIM_BODY_MAX) : 0;
+  parser.feed(body, len);
+  refresh_arena.free(body);
+  traffic_record(url, traffic_request_bytes(url), len, len > 0);
+  return len ? HTTP_CODE_OK : HTTPC_ERROR_CONNECTION_REFUSED;
+#else
+  HTTPClient http;
+  http.useHTTP10(true);  // No chunked encoding, so the body can be read raw
+  http.begin(url);
+
+  int code = http.GET();
+  size_t received = 0;
+  if (code == HTTP_CODE_OK) received = stream_body(http, parser);
+  http.end();
+  traffic_record(url, traffic_request_bytes(url), received, code == HTTP_CODE_OK);
+  return code;
+#endif
 }
 
 void fetch_and_update_weather() {
-  if (WiFi.status() != WL_CONNECTED) {
-    Serial.println("WiFi no longer connected. Attempting to reconnect...");
+  StallScope stall("fetch_and_update_weather");
+  TraceScope trace("fetch_and_update_weather");
+  ArenaScope scratch(refresh_arena);
+  if (!network_up()) {
+    LOG_W("WiFi no longer connected. Attempting to reconnect...");
+    metrics_wifi_reconnect();
     WiFi.disconnect();
     WiFiManager wm;  
     wm.autoConnect(DEFAULT_CAPTIVE_SSID);
     delay(1000);  
     if (WiFi.status() != WL_CONNECTED) { 
-      Serial.println("WiFi connection still unavailable.");
+      LOG_W("WiFi connection still unavailable.");
       return;   
     }
-    Serial.println("WiFi connection reestablished.");
+    LOG_I("WiFi connection reestablished.");
   }
 
 
-  String url = String("http://api.open-meteo.com/v1/forecast?latitude=")
-               + latitude + "&longitude=" + longitude
-               + "&current=temperature_2m,apparent_temperature,is_day,weather_code"
-               + "&daily=temperature_2m_min,temperature_2m_max,weather_code,sunrise,sunset"
-               + "&hourly=temperature_2m,precipitation_probability,precipitation,is_day,weather_code"
-               + "&forecast_hours=7"
-               + "&timezone=auto";
+  // One request for every saved location; coordinates are comma-separated.
+  // Times come back as unix seconds and values in the display units, so
+  // the response can be parsed and shown with integer arithmetic alone.
+  StackStr<512> url;
+  url.add(FORECAST_URL "?latitude=");
+  for (int i = 0; i < location_count; i++) {
+    if (i) url.add(',');
+    url.add(locations[i].latitude);
+  }
+  url.add("&longitude=");
+  for (int i = 0; i < location_count; i++) {
+    if (i) url.add(',');
+    url.add(locations[i].longitude);
+  }
+  url.add("&current=temperature_2m,apparent_temperature,is_day,weather_code")
+     .add("&daily=temperature_2m_min,temperature_2m_max,weather_code,sunrise,sunset")
+     .add("&hourly=temperature_2m,precipitation_probability,precipitation,is_day,weather_code")
+     .add("&forecast_days=7")
+     .add("&forecast_hours=7")
+     .add("&timeformat=unixtime")
+     .add(use_fahrenheit ? "&temperature_unit=fahrenheit&precipitation_unit=inch" : "")
+     .add("&timezone=auto");
+  if (url.truncated()) {
+    LOG_E("Forecast URL too long: %s", url.c_str());
+    return;
+  }
 
-  HTTPClient http;
-  http.begin(url);
+  // Several locations come back as a JSON array of forecasts, parsed in
+  // one pass straight into the per-location models
+  WeatherModel *models = (WeatherModel *)refresh_arena.alloc(sizeof(WeatherModel) * location_count);
+  if (!models) {
+    LOG_E("Refresh arena full, forecast not fetched");
+    return;
+  }
+  OpenMeteoParser parser(models, location_count);
+
+  uint32_t fetch_start = millis();
+  bool fetched = false;
+  int code = http_stream(url.c_str(), parser);
+  if (code == HTTP_CODE_OK && parser.parsed() == location_count) {
+    LOG_I("Updated weather from open-meteo: %s", url.c_str());
+    fetched = true;
+    apply_forecast(models);
+
+    int utc_offset_seconds = weather[0].utc_offset_seconds;
+    configTime(utc_offset_seconds, 0, "pool.ntp.org", "time.nist.gov");
+    LOG_I("Updating time from NTP with UTC offset: %d", utc_offset_seconds);
+  } else if (code == HTTP_CODE_OK) {
+    LOG_W("JSON parse failed on result from %s", url.c_str());
+  } else {
+    LOG_W("HTTP GET failed at %s", url.c_str());
+  }
+  metrics_fetch(METRICS_FETCH_WEATHER, millis() - fetch_start, fetched);
+}
 
-  if (http.GET() == HTTP_CODE_OK) {
-    Serial.println("Updated weather from open-meteo: " + url);
+// Show a freshly parsed forecast for every saved location
+static void apply_forecast(const WeatherModel *models) {
+  for (int i = 0; i < location_count; i++) {
+    weather[i] = models[i];
+    weather[i].fahrenheit = use_fahrenheit;
+  }
+  render_weather();
+}
 
-    String payload = http.getString();
-    DynamicJsonDocument doc(32 * 1024);
+#if CONFIG_SOAK_TEST
+#define SOAK_TICK_MS 1000           // Simulated LVGL time per loop() pass
+#define SOAK_JSON_MAX 4096
+#define SOAK_WINDOW 200             // Passes per heap growth check
+#define SOAK_WARMUP_WINDOWS 5
+#define SOAK_TOLERANCE 1024         // Bytes the heap floor may rise
+#define SOAK_REPORT_EVERY 1000
+
+static SoakMonitor soak_monitor(SOAK_WINDOW, SOAK_WARMUP_WINDOWS, SOAK_TOLERANCE);
+static uint32_t soak_passes = 0;
+
+// A refresh without the network: a synthetic response through the real
+// parser and render path
+static void soak_refresh() {
+  ArenaScope scratch(refresh_arena);
+  char *json = (char *)refresh_arena.alloc(SOAK_JSON_MAX);
+  WeatherModel *models = (WeatherModel *)refresh_arena.alloc(sizeof(WeatherModel) * location_count);
+  if (!json || !models) {
+    LOG_E("Soak: refresh arena full");
+    return;
+  }
 
-    if (deserializeJson(doc, payload) == DeserializationError::Ok) {
-      float t_now = doc["current"]["temperature_2m"].as<float>();
-      float t_ap = doc["current"]["apparent_temperature"].as<float>();
-      int code_now = doc["current"]["weather_code"].as<int>();
-      int is_day = doc["current"]["is_day"].as<int>();
+  uint32_t now = 1700000000 + soak_passes * (UPDATE_INTERVAL / 1000);
+  size_t len = soak_forecast_json(json, SOAK_JSON_MAX, location_count, soak_passes, now);
+  OpenMeteoParser parser(models, location_count);
+  parser.feed(json, len);
+  if (parser.parsed() == location_count) {
+    apply_forecast(models);
+  } else {
+    LOG_E("Soak: synthetic forecast did not parse");
+  }
+}
 
-      if (use_fahrenheit) {
-        t_now = t_now * 9.0 / 5.0 + 32.0;
-        t_ap = t_ap * 9.0 / 5.0 + 32.0;
-      }
-      const LocalizedStrings* strings = get_strings(current_language);
-
-      int utc_offset_seconds = doc["utc_offset_seconds"].as<int>();
-      configTime(utc_offset_seconds, 0, "pool.ntp.org", "time.nist.gov");
-      Serial.print("Updating time from NTP with UTC offset: ");
-      Serial.println(utc_offset_seconds);
-
-      char unit = use_fahrenheit ? 'F' : 'C';
-      lv_label_set_text_fmt(lbl_today_temp, "%.0f°%c", t_now, unit);
-      lv_label_set_text_fmt(lbl_today_feels_like, "%s %.0f°%c", strings->feels_like_temp, t_ap, unit);
-      lv_img_set_src(img_today_icon, choose_image(code_now, is_day));
-
-      JsonArray times = doc["daily"]["time"].as<JsonArray>();
-      JsonArray tmin = doc["daily"]["temperature_2m_min"].as<JsonArray>();
-      JsonArray tmax = doc["daily"]["temperature_2m_max"].as<JsonArray>();
-      JsonArray weather_codes = doc["daily"]["weather_code"].as<JsonArray>();
-      JsonArray sunrises = doc["daily"]["sunrise"].as<JsonArray>();
-      JsonArray sunsets = doc["daily"]["sunset"].as<JsonArray>();
-
-      // Display today's sunrise and sunset times
-      if (sunrises.size() > 0 && sunsets.size() > 0) {
-        const char *sunrise_str = sunrises[0].as<const char*>();
-        const char *sunset_str = sunsets[0].as<const char*>();
-        
-        // Parse time from ISO8601 format "YYYY-MM-DDTHH:MM"
-        int sunrise_hour = atoi(sunrise_str + 11);
-        int sunrise_min = atoi(sunrise_str + 14);
-        int sunset_hour = atoi(sunset_str + 11);
-        int sunset_min = atoi(sunset_str + 14);
-        
-        char sunrise_buf[32];
-        char sunset_buf[32];
-        
-        if (use_24_hour) {
-          snprintf(sunrise_buf, sizeof(sunrise_buf), "%s %02d:%02d", strings->sunrise, sunrise_hour, sunrise_min);
-          snprintf(sunset_buf, sizeof(sunset_buf), "%s %02d:%02d", strings->sunset, sunset_hour, sunset_min);
-        } else {
-          int sr_h = sunrise_hour % 12;
-          if (sr_h == 0) sr_h = 12;
-          const char *sr_ampm = (sunrise_hour < 12) ? strings->am : strings->pm;
-          
-          int ss_h = sunset_hour % 12;
-          if (ss_h == 0) ss_h = 12;
-          const char *ss_ampm = (sunset_hour < 12) ? strings->am : strings->pm;
-          
-          snprintf(sunrise_buf, sizeof(sunrise_buf), "%s %d:%02d%s", strings->sunrise, sr_h, sunrise_min, sr_ampm);
-          snprintf(sunset_buf, sizeof(sunset_buf), "%s %d:%02d%s", strings->sunset, ss_h, sunset_min, ss_ampm);
-        }
-        
-        lv_label_set_text(lbl_sunrise, sunrise_buf);
-        lv_label_set_text(lbl_sunset, sunset_buf);
-      }
+static void soak_sample() {
+  HeapSample sample = {};
+  sample.free = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  sample.in_use = heap_caps_get_total_size(MALLOC_CAP_8BIT) - sample.free;
+  sample.largest_free = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+  lv_mem_monitor_t mon;
+  lv_mem_monitor(&mon);
+  sample.lvgl_used = mon.total_size - mon.free_size;
+  sample.lvgl_frag_pct = mon.frag_pct;
+#endif
 
-      for (int i = 0; i < 7; i++) {
-        const char *date = times[i];
-        int year = atoi(date + 0);
-        int mon = atoi(date + 5);
-        int dayd = atoi(date + 8);
-        int dow = day_of_week(year, mon, dayd);
-        const char *dayStr = (i == 0 && current_language != LANG_FR) ? strings->today : strings->weekdays[dow];
-
-        float mn = tmin[i].as<float>();
-        float mx = tmax[i].as<float>();
-        if (use_fahrenheit) {
-          mn = mn * 9.0 / 5.0 + 32.0;
-          mx = mx * 9.0 / 5.0 + 32.0;
-        }
-
-        lv_label_set_text_fmt(lbl_daily_day[i], "%s", dayStr);
-        lv_label_set_text_fmt(lbl_daily_high[i], "%.0f°%c", mx, unit);
-        lv_label_set_text_fmt(lbl_daily_low[i], "%.0f°%c", mn, unit);
-        lv_img_set_src(img_daily[i], choose_icon(weather_codes[i].as<int>(), (i == 0) ? is_day : 1));
-      }
+  bool ok = soak_monitor.sample(sample);
+  if (!ok || soak_monitor.samples() % SOAK_REPORT_EVERY == 0) {
+    char report[160];
+    soak_monitor.report(report, sizeof(report));
+    if (ok) {
+      LOG_I("Soak: %s", report);
+    } else {
+      LOG_E("Soak: %s", report);
+    }
+  }
+}
 
-      JsonArray hours = doc["hourly"]["time"].as<JsonArray>();
-      JsonArray hourly_temps = doc["hourly"]["temperature_2m"].as<JsonArray>();
-      JsonArray precipitation_probabilities = doc["hourly"]["precipitation_probability"].as<JsonArray>();
-      JsonArray precipitations = doc["hourly"]["precipitation"].as<JsonArray>();
-      JsonArray hourly_weather_codes = doc["hourly"]["weather_code"].as<JsonArray>();
-      JsonArray hourly_is_day = doc["hourly"]["is_day"].as<JsonArray>();
-
-      for (int i = 0; i < 7; i++) {
-        const char *date = hours[i];  // "YYYY-MM-DD"
-        int hour = atoi(date + 11);
-        int minute = atoi(date + 14);
-        String hour_name = hour_of_day(hour);
-
-        float precipitation_probability = precipitation_probabilities[i].as<float>();
-        float precipitation_mm = precipitations[i].as<float>();
-        float temp = hourly_temps[i].as<float>();
-        if (use_fahrenheit) {
-          temp = temp * 9.0 / 5.0 + 32.0;
-        }
-
-        if (i == 0 && current_language != LANG_FR) {
-          lv_label_set_text(lbl_hourly[i], strings->now);
-        } else {
-          lv_label_set_text(lbl_hourly[i], hour_name.c_str());
-        }
-        
-        // Show precipitation amount if > 0, otherwise show probability
-        if (precipitation_mm >= 0.1f) {
-          if (use_fahrenheit) {
-            // Convert mm to inches (1 inch = 25.4 mm)
-            float precipitation_in = precipitation_mm / 25.4f;
-            lv_label_set_text_fmt(lbl_precipitation_probability[i], "%.1fin", precipitation_in);
-          } else {
-            lv_label_set_text_fmt(lbl_precipitation_probability[i], "%.1fmm", precipitation_mm);
-          }
-        } else if (precipitation_probability > 0) {
-          lv_label_set_text_fmt(lbl_precipitation_probability[i], "%.0f%%", precipitation_probability);
-        } else {
-          lv_label_set_text(lbl_precipitation_probability[i], "");
-        }
-        
-        lv_label_set_text_fmt(lbl_hourly_temp[i], "%.0f°%c", temp, unit);
-        lv_img_set_src(img_hourly[i], choose_icon(hourly_weather_codes[i].as<int>(), hourly_is_day[i].as<int>()));
-      }
+// Called instead of the network half of setup()
+static void soak_begin() {
+  LOG_W("Soak mode: no network, synthetic forecasts every %d simulated ms", SOAK_TICK_MS);
+  lv_lock();
+  lv_timer_create(STALL_TIMER(update_clock), 1000, NULL);
+  lv_obj_clean(lv_scr_act());
+  create_ui();
+  lv_unlock();
+  trace_end();
+  trace_boot_done();
+}
 
+// One simulated refresh interval per pass, with the UI exercised in
+// between: panel slides, the settings window and an offline location
+// search. Preferences are never written, so flash is not worn.
+static void soak_loop() {
+  static const char *const queries[] = {"Lon", "Par", "New Y", "São", "Ber", "Tok"};
+  if (soak_monitor.failed()) {
+    delay(1000);
+    return;
+  }
+
+  lv_tick_inc(SOAK_TICK_MS);
+  lv_timer_handler();
+
+  lv_lock();
+  soak_refresh();
+  if (soak_passes % 3 == 0) rotate_to_next_panel();
+  if (soak_passes % 50 == 0) {
+    create_settings_window();
+    lv_timer_handler();
+    lv_obj_del(settings_win);
+    settings_win = nullptr;
+  }
+  if (soak_passes % 20 == 10) {
+    create_location_dialog();
+    if (location_win) {
+      run_location_search(queries[(soak_passes / 20) % (sizeof(queries) / sizeof(queries[0]))], false);
+      lv_timer_handler();
+      lv_obj_del(location_win);
+    }
+  }
+  lv_unlock();
+
+  soak_passes++;
+  soak_sample();
+  delay(1);  // Let the log task drain
+}
+#endif
+
+#if CONFIG_TRAFFIC_SIM
+// Called instead of the network half of setup(). Runs with the settings
+// saved on the device, so configure it first and then flash this build.
+static void sim_begin() {
+  int bus_stops = 0;
+  for (int i = 0; i < MAX_BUS_STOPS; i++) {
+    if (strlen(bus_stop_ids[i]) > 0) bus_stops++;
+  }
+  LOG_W("Traffic simulation: %d location(s), %d bus stop(s), tube %s, auto-rotate %s", location_count, bus_stops,
+        strlen(tube_station_id) > 0 ? "on" : "off", auto_rotate_enabled ? "on" : "off");
+
+  lv_lock();
+  lv_timer_create(STALL_TIMER(update_clock), 1000, NULL);
+  lv_obj_clean(lv_scr_act());
+  create_ui();
+  fetch_and_update_weather();
+  lv_unlock();
+  trace_end();
+  trace_boot_done();
+}
+
+// The normal loop on a virtual clock: LVGL timers (transit refresh, panel
+// and location rotation, the clock) and the weather schedule all see
+// SIM_STEP_MS pass on every pass, and the requests go to stub endpoints
+static void sim_loop() {
+  static bool done = false;
+  if (done) {
+    delay(1000);
+    return;
+  }
+
+  sim_ms += SIM_STEP_MS;
+  lv_tick_inc(SIM_STEP_MS);
+  lv_timer_handler();
+  poll_weather_refresh();
 
+  if (sim_ms % 3600000 == 0) LOG_I("Traffic simulation: %lu h", (unsigned long)(sim_ms / 3600000));
+  if (sim_ms >= SIM_DURATION_MS) {
+    done = true;
+    dump_traffic(sim_ms);
+  }
+  if (sim_ms % 1000 == 0) delay(1);  // Let the log task drain
+}
+#endif
+
+// Temperature label such as "21°C", rounded to whole degrees
+static void format_temperature(char *buf, size_t size, int16_t tenths, char unit) {
+  size_t len = format_int(buf, size, fixed_round(tenths, 10));
+  len = append_bounded(buf, len, size, "°");
+  if (len + 1 < size) {
+    buf[len++] = unit;
+    buf[len] = '\0';
+  }
+}
+
+// Show the forecast of current_location
+void render_weather() {
+  TraceScope trace("render_weather");
+  if (location_count > 1) {
+    lv_label_set_text(lbl_location_name, locations[current_location].name);
+  } else {
+    lv_label_set_text(lbl_location_name, "");
+  }
+
+  const WeatherModel &m = weather[current_location];
+  if (!m.valid) return;
+
+  const LocalizedStrings* strings = get_strings(current_language);
+  char unit = m.fahrenheit ? 'F' : 'C';
+  char buf[48];
+
+  format_temperature(buf, sizeof(buf), m.t_now, unit);
+  lv_label_set_text(lbl_today_temp, buf);
+  size_t len = append_bounded(buf, 0, sizeof(buf), strings->feels_like_temp);
+  len = append_bounded(buf, len, sizeof(buf), " ");
+  format_temperature(buf + len, sizeof(buf) - len, m.t_feels, unit);
+  lv_label_set_text(lbl_today_feels_like, buf);
+  lv_img_set_src(img_today_icon, choose_image(m.code_now, m.is_day));
+
+  // Display today's sunrise and sunset times
+  if (m.sunrise && m.sunset) {
+    int sunrise_hour = local_hour(m.sunrise, m.utc_offset_seconds);
+    int sunrise_min = local_minute(m.sunrise, m.utc_offset_seconds);
+    int sunset_hour = local_hour(m.sunset, m.utc_offset_seconds);
+    int sunset_min = local_minute(m.sunset, m.utc_offset_seconds);
+
+    char sunrise_buf[32];
+    char sunset_buf[32];
+
+    if (use_24_hour) {
+      snprintf(sunrise_buf, sizeof(sunrise_buf), "%s %02d:%02d", strings->sunrise, sunrise_hour, sunrise_min);
+      snprintf(sunset_buf, sizeof(sunset_buf), "%s %02d:%02d", strings->sunset, sunset_hour, sunset_min);
     } else {
-      Serial.println("JSON parse failed on result from " + url);
+      int sr_h = sunrise_hour % 12;
+      if (sr_h == 0) sr_h = 12;
+      const char *sr_ampm = (sunrise_hour < 12) ? strings->am : strings->pm;
+
+      int ss_h = sunset_hour % 12;
+      if (ss_h == 0) ss_h = 12;
+      const char *ss_ampm = (sunset_hour < 12) ? strings->am : strings->pm;
+
+      snprintf(sunrise_buf, sizeof(sunrise_buf), "%s %d:%02d%s", strings->sunrise, sr_h, sunrise_min, sr_ampm);
+      snprintf(sunset_buf, sizeof(sunset_buf), "%s %d:%02d%s", strings->sunset, ss_h, sunset_min, ss_ampm);
     }
+
+    lv_label_set_text(lbl_sunrise, sunrise_buf);
+    lv_label_set_text(lbl_sunset, sunset_buf);
+  }
+
+  mark_panel_dirty(PANEL_DAILY);
+  mark_panel_dirty(PANEL_HOURLY);
+}
+
+static void render_daily_panel() {
+  const WeatherModel &m = weather[current_location];
+  if (!m.valid) return;
+
+  const LocalizedStrings* strings = get_strings(current_language);
+  char unit = m.fahrenheit ? 'F' : 'C';
+  char high[16];
+  char low[16];
+
+  for (int i = 0; i < FORECAST_DAYS; i++) {
+    const DailyForecast &d = m.daily[i];
+    int dow = local_weekday(d.time, m.utc_offset_seconds);
+    const char *dayStr = (i == 0 && current_language != LANG_FR) ? strings->today : strings->weekdays[dow];
+
+    format_temperature(high, sizeof(high), d.t_max, unit);
+    format_temperature(low, sizeof(low), d.t_min, unit);
+    forecast_table_set_row(box_daily, i, dayStr, choose_icon(d.code, (i == 0) ? m.is_day : 1), low, high);
+  }
+}
+
+static void render_hourly_panel() {
+  const WeatherModel &m = weather[current_location];
+  if (!m.valid) return;
+
+  const LocalizedStrings* strings = get_strings(current_language);
+  char unit = m.fahrenheit ? 'F' : 'C';
+  char temp[16];
+  char precip[16];
+  size_t len;
+
+  for (int i = 0; i < FORECAST_HOURS; i++) {
+    const HourlyForecast &h = m.hourly[i];
+
+    StackStr<16> hour;
+    if (i == 0 && current_language != LANG_FR) {
+      hour.add(strings->now);
+    } else {
+      hour_of_day(hour, local_hour(h.time, m.utc_offset_seconds));
+    }
+
+    // Show precipitation amount if any, otherwise show probability
+    if (format_precip(precip, sizeof(precip), h.precip, m.fahrenheit) == 0 && h.precip_prob > 0) {
+      len = format_int(precip, sizeof(precip), h.precip_prob);
+      append_bounded(precip, len, sizeof(precip), "%");
+    }
+
+    format_temperature(temp, sizeof(temp), h.temp, unit);
+    forecast_table_set_row(box_hourly, i, hour.c_str(), choose_icon(h.code, h.is_day), precip, temp);
+  }
+}
+
+// Preference keys are "latitude", "longitude", "location" for the home
+// slot (as before multiple locations) and "latitude2" etc. for the others
+static void location_pref_key(char *key, size_t len, const char *base, int slot) {
+  if (slot == 0) {
+    snprintf(key, len, "%s", base);
   } else {
-    Serial.println("HTTP GET failed at " + url);
+    snprintf(key, len, "%s%d", base, slot + 1);
+  }
+}
+
+void load_locations() {
+  const char* lat_default = (strlen(CONFIG_LATITUDE) > 0) ? CONFIG_LATITUDE : LATITUDE_DEFAULT;
+  const char* lon_default = (strlen(CONFIG_LONGITUDE) > 0) ? CONFIG_LONGITUDE : LONGITUDE_DEFAULT;
+  const char* loc_default = (strlen(CONFIG_LOCATION) > 0) ? CONFIG_LOCATION : LOCATION_DEFAULT;
+
+  location_count = 0;
+  for (int slot = 0; slot < MAX_LOCATIONS; slot++) {
+    char key[16];
+    SavedLocation &loc = locations[location_count];
+
+    location_pref_key(key, sizeof(key), "latitude", slot);
+    String lat = prefs.getString(key, slot ? "" : lat_default);
+    location_pref_key(key, sizeof(key), "longitude", slot);
+    String lon = prefs.getString(key, slot ? "" : lon_default);
+    location_pref_key(key, sizeof(key), "location", slot);
+    String name = prefs.getString(key, slot ? "" : loc_default);
+
+    if (lat.length() == 0 || lon.length() == 0) continue;
+    lat.toCharArray(loc.latitude, sizeof(loc.latitude));
+    lon.toCharArray(loc.longitude, sizeof(loc.longitude));
+    name.toCharArray(loc.name, sizeof(loc.name));
+    location_count++;
+  }
+  current_location = 0;
+}
+
+void save_locations() {
+  for (int slot = 0; slot < MAX_LOCATIONS; slot++) {
+    char key[16];
+    bool used = slot < location_count;
+
+    location_pref_key(key, sizeof(key), "latitude", slot);
+    if (used) prefs.putString(key, locations[slot].latitude); else prefs.remove(key);
+    location_pref_key(key, sizeof(key), "longitude", slot);
+    if (used) prefs.putString(key, locations[slot].longitude); else prefs.remove(key);
+    location_pref_key(key, sizeof(key), "location", slot);
+    if (used) prefs.putString(key, locations[slot].name); else prefs.remove(key);
+  }
+}
+
+static void location_rotate_cb(lv_timer_t *timer) {
+  current_location = (current_location + 1) % location_count;
+  render_weather();
+}
+
+// Start or stop cycling through locations to match the saved count
+void update_location_rotation() {
+  if (current_location >= location_count) current_location = 0;
+
+  if (location_count > 1 && !location_rotate_timer) {
+    location_rotate_timer = lv_timer_create(STALL_TIMER(location_rotate_cb), LOCATION_ROTATE_INTERVAL, NULL);
+  } else if (location_count <= 1 && location_rotate_timer) {
+    lv_timer_del(location_rotate_timer);
+    location_rotate_timer = nullptr;
   }
-  http.end();
 }
 
 // Helper function to check if any bus stop is configured
@@ -1729,7 +2651,8 @@ bool any_bus_stop_configured() {
 
 // Transit refresh timer callback
 static void transit_refresh_callback(lv_timer_t *timer) {
-  if (transit_enabled) {
+  // Skipped during a panel slide, which the blocking fetch would stall
+  if (transit_enabled && !slide_from) {
     fetch_tfl_arrivals();
   }
 }
@@ -1745,129 +2668,71 @@ void fetch_tfl_arrivals() {
   update_transit_display();
 }
 
+// Stream a TfL arrivals response through the parser without buffering it
+static bool stream_arrivals(const char *url, ArrivalParser &parser) {
+  uint32_t fetch_start = millis();
+  bool ok = http_stream(url, parser) == HTTP_CODE_OK && parser.complete();
+  metrics_fetch(METRICS_FETCH_TRANSIT, millis() - fetch_start, ok);
+  return ok;
+}
+
 void fetch_bus_arrivals() {
-  if (WiFi.status() != WL_CONNECTED) return;
-  
-  // Temporary storage for all arrivals from all stops
-  ArrivalInfo all_arrivals[30];  // Up to 10 arrivals per stop
-  int total_count = 0;
-  
-  // Fetch arrivals from each configured bus stop
+  StallScope stall("fetch_bus_arrivals");
+  TraceScope trace("fetch_bus_arrivals");
+  if (!network_up()) return;
+
+  // Soonest arrivals across all configured stops
+  ArrivalTopK top;
+  ArrivalParser parser(top, false);
+
   for (int stop = 0; stop < MAX_BUS_STOPS; stop++) {
     if (strlen(bus_stop_ids[stop]) == 0) continue;
-    
-    String url = String("https://api.tfl.gov.uk/StopPoint/") + bus_stop_ids[stop] + "/Arrivals";
-    
-    HTTPClient http;
-    http.begin(url);
-    
-    if (http.GET() == HTTP_CODE_OK) {
-      Serial.println("Fetched bus arrivals from TfL: " + url);
-      
-      String payload = http.getString();
-      DynamicJsonDocument doc(8 * 1024);
-      
-      if (deserializeJson(doc, payload) == DeserializationError::Ok) {
-        JsonArray arrivals = doc.as<JsonArray>();
-        
-        int count = min((int)arrivals.size(), 10);
-        for (int i = 0; i < count && total_count < 30; i++) {
-          JsonObject arrival = arrivals[i];
-          strncpy(all_arrivals[total_count].line, arrival["lineName"] | "?", sizeof(all_arrivals[total_count].line) - 1);
-          strncpy(all_arrivals[total_count].destination, arrival["destinationName"] | "?", sizeof(all_arrivals[total_count].destination) - 1);
-          all_arrivals[total_count].timeToStation = arrival["timeToStation"].as<int>();
-          total_count++;
-        }
-      } else {
-        Serial.println("JSON parse failed for bus arrivals");
-      }
+
+    StackStr<96> url;
+    url.add(TFL_STOP_URL).add(bus_stop_ids[stop]).add("/Arrivals");
+
+    parser.reset();
+    if (stream_arrivals(url.c_str(), parser)) {
+      LOG_D("Fetched bus arrivals from TfL: %s", url.c_str());
     } else {
-      Serial.println("HTTP GET failed for bus arrivals: " + url);
-    }
-    http.end();
-  }
-  
-  // Sort all arrivals by timeToStation using bubble sort
-  for (int i = 0; i < total_count - 1; i++) {
-    for (int j = 0; j < total_count - i - 1; j++) {
-      if (all_arrivals[j].timeToStation > all_arrivals[j + 1].timeToStation) {
-        ArrivalInfo temp = all_arrivals[j];
-        all_arrivals[j] = all_arrivals[j + 1];
-        all_arrivals[j + 1] = temp;
-      }
+      LOG_W("HTTP GET failed for bus arrivals: %s", url.c_str());
     }
   }
-  
-  // Copy first 4 arrivals to display
-  bus_arrival_count = min(total_count, 4);
-  for (int i = 0; i < bus_arrival_count; i++) {
-    bus_arrivals[i] = all_arrivals[i];
-  }
+
+  bus_arrival_count = top.take_sorted(bus_arrivals);
 }
 
 void fetch_tube_arrivals() {
-  if (WiFi.status() != WL_CONNECTED) return;
-  
-  String url = String("https://api.tfl.gov.uk/StopPoint/") + tube_station_id + "/Arrivals";
-  
-  HTTPClient http;
-  http.begin(url);
-  
-  if (http.GET() == HTTP_CODE_OK) {
-    Serial.println("Fetched tube arrivals from TfL: " + url);
-    
-    String payload = http.getString();
-    DynamicJsonDocument doc(16 * 1024);
-    
-    if (deserializeJson(doc, payload) == DeserializationError::Ok) {
-      JsonArray arrivals = doc.as<JsonArray>();
-      
-      // Sort arrivals by timeToStation and take first 4
-      int count = min((int)arrivals.size(), 10);
-      int indices[10];
-      int times[10];
-      
-      for (int i = 0; i < count; i++) {
-        indices[i] = i;
-        times[i] = arrivals[i]["timeToStation"].as<int>();
-      }
-      
-      for (int i = 0; i < count - 1; i++) {
-        for (int j = 0; j < count - i - 1; j++) {
-          if (times[j] > times[j + 1]) {
-            int temp = times[j];
-            times[j] = times[j + 1];
-            times[j + 1] = temp;
-            temp = indices[j];
-            indices[j] = indices[j + 1];
-            indices[j + 1] = temp;
-          }
-        }
-      }
-      
-      tube_arrival_count = min(count, 4);
-      for (int i = 0; i < tube_arrival_count; i++) {
-        JsonObject arrival = arrivals[indices[i]];
-        strncpy(tube_arrivals[i].line, arrival["lineName"] | "?", sizeof(tube_arrivals[i].line) - 1);
-        strncpy(tube_arrivals[i].destination, arrival["towards"] | arrival["destinationName"] | "?", sizeof(tube_arrivals[i].destination) - 1);
-        tube_arrivals[i].timeToStation = arrival["timeToStation"].as<int>();
-      }
-    } else {
-      Serial.println("JSON parse failed for tube arrivals");
-      tube_arrival_count = 0;
-    }
+  StallScope stall("fetch_tube_arrivals");
+  TraceScope trace("fetch_tube_arrivals");
+  if (!network_up()) return;
+
+  StackStr<96> url;
+  url.add(TFL_STOP_URL).add(tube_station_id).add("/Arrivals");
+
+  ArrivalTopK top;
+  ArrivalParser parser(top, true);
+
+  if (stream_arrivals(url.c_str(), parser)) {
+    LOG_D("Fetched tube arrivals from TfL: %s", url.c_str());
   } else {
-    Serial.println("HTTP GET failed for tube arrivals: " + url);
-    tube_arrival_count = 0;
+    LOG_W("HTTP GET failed for tube arrivals: %s", url.c_str());
   }
-  http.end();
+
+  tube_arrival_count = top.take_sorted(tube_arrivals);
 }
 
+// New arrivals are only drawn once the transit panel is on screen
 void update_transit_display() {
+  TraceScope trace("update_transit_display");
+  mark_panel_dirty(PANEL_TRANSIT);
+}
+
+static void render_transit_panel() {
   const LocalizedStrings* strings = get_strings(current_language);
   
   // Update bus arrivals display
-  for (int i = 0; i < 4; i++) {
+  for (int i = 0; i < ARRIVALS_SHOWN; i++) {
     if (i < bus_arrival_count) {
       int mins = bus_arrivals[i].timeToStation / 60;
       char buf[64];
@@ -1899,7 +2764,7 @@ void update_transit_display() {
   }
   
   // Update tube arrivals display
-  for (int i = 0; i < 4; i++) {
+  for (int i = 0; i < ARRIVALS_SHOWN; i++) {
     if (i < tube_arrival_count) {
       int mins = tube_arrivals[i].timeToStation / 60;
       char buf[64];
@@ -1931,107 +2796,228 @@ void update_transit_display() {
   }
 }
 
+static lv_obj_t *panel_box(int panel) {
+  switch (panel) {
+    case PANEL_HOURLY: return box_hourly;
+    case PANEL_TRANSIT: return box_transit;
+    default: return box_daily;
+  }
+}
+
+static void render_panel(int panel) {
+  switch (panel) {
+    case PANEL_DAILY: render_daily_panel(); break;
+    case PANEL_HOURLY: render_hourly_panel(); break;
+    case PANEL_TRANSIT: render_transit_panel(); break;
+  }
+  panel_dirty[panel] = false;
+}
+
+// Record that a panel's data changed; only the panel on screen is rendered
+// now, the others wait until show_panel()
+static void mark_panel_dirty(int panel) {
+  panel_dirty[panel] = true;
+  if (panel == current_panel) render_panel(panel);
+}
+
+static void panel_slide_anim_cb(void *from, int32_t offset) {
+  lv_obj_set_style_translate_x((lv_obj_t *)from, offset, LV_PART_MAIN);
+  lv_obj_set_style_translate_x(slide_target, offset + PANEL_WIDTH + PANEL_SLIDE_GAP, LV_PART_MAIN);
+}
+
+// The screen is rebuilt (create_ui) with the slide running
+static void panel_slide_delete_cb(lv_event_t *e) {
+  slide_from = nullptr;
+  slide_target = nullptr;
+}
+
+static void panel_slide_end() {
+  lv_obj_remove_event_cb(slide_from, panel_slide_delete_cb);
+  lv_obj_remove_local_style_prop(slide_from, LV_STYLE_TRANSLATE_X, LV_PART_MAIN);
+  lv_obj_remove_local_style_prop(slide_target, LV_STYLE_TRANSLATE_X, LV_PART_MAIN);
+  slide_from = nullptr;
+  slide_target = nullptr;
+}
+
+// Jump a running slide to its end
+static void finish_panel_slide() {
+  if (!slide_from) return;
+  lv_anim_delete(slide_from, panel_slide_anim_cb);
+  lv_obj_add_flag(slide_from, LV_OBJ_FLAG_HIDDEN);
+  panel_slide_end();
+
+  // A frame longer than the refresh period drops frames of the slide
+  if (slide_worst_frame_us > LV_DEF_REFR_PERIOD * 1000) {
+    LOG_W("Panel slide: worst frame %lu us, over the %d ms refresh period", (unsigned long)slide_worst_frame_us,
+          LV_DEF_REFR_PERIOD);
+  } else {
+    LOG_I("Panel slide: worst frame %lu us", (unsigned long)slide_worst_frame_us);
+  }
+}
+
+static void panel_slide_done_cb(lv_anim_t *a) {
+  lv_obj_t *target = slide_target;
+  finish_panel_slide();
+  if (target == box_transit) fetch_tfl_arrivals();  // Held back by show_panel()
+}
+
+// Slide from the panel on screen to the next one, which must be rendered
+// and hidden. Returns false, leaving the caller to switch instantly, if
+// there is nothing on screen to slide away.
+static bool start_panel_slide(lv_obj_t *from, lv_obj_t *to) {
+  if (lv_obj_has_flag(from, LV_OBJ_FLAG_HIDDEN)) return false;
+
+  slide_from = from;
+  slide_target = to;
+  slide_worst_frame_us = 0;
+  lv_obj_add_event_cb(from, panel_slide_delete_cb, LV_EVENT_DELETE, NULL);
+  panel_slide_anim_cb(from, 0);
+  lv_obj_clear_flag(to, LV_OBJ_FLAG_HIDDEN);
+
+  lv_anim_t a;
+  lv_anim_init(&a);
+  lv_anim_set_var(&a, from);
+  lv_anim_set_exec_cb(&a, panel_slide_anim_cb);
+  lv_anim_set_values(&a, 0, -(PANEL_WIDTH + PANEL_SLIDE_GAP));
+  lv_anim_set_duration(&a, PANEL_SLIDE_TIME);
+  lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
+  lv_anim_set_completed_cb(&a, panel_slide_done_cb);
+  lv_anim_start(&a);
+  return true;
+}
+
+static void show_panel(int panel) {
+  const LocalizedStrings* strings = get_strings(current_language);
+
+  finish_panel_slide();
+  int previous = current_panel;
+  for (int i = 0; i < PANEL_COUNT; i++) {
+    if (i != panel && i != previous) lv_obj_add_flag(panel_box(i), LV_OBJ_FLAG_HIDDEN);
+  }
+  current_panel = panel;
+
+  switch (panel) {
+    case PANEL_DAILY: lv_label_set_text(lbl_forecast, strings->seven_day_forecast); break;
+    case PANEL_HOURLY: lv_label_set_text(lbl_forecast, strings->hourly_forecast); break;
+    case PANEL_TRANSIT: lv_label_set_text(lbl_forecast, strings->transit_title); break;
+  }
+
+  // Catch up while still hidden, so unhiding redraws the panel only once
+  if (panel_dirty[panel]) render_panel(panel);
+  bool sliding = CONFIG_PANEL_SLIDE && previous != panel && start_panel_slide(panel_box(previous), panel_box(panel));
+  if (!sliding) {
+    if (previous != panel) lv_obj_add_flag(panel_box(previous), LV_OBJ_FLAG_HIDDEN);
+    lv_obj_clear_flag(panel_box(panel), LV_OBJ_FLAG_HIDDEN);
+  }
+
+  // Refresh transit data when viewing. The fetch blocks, so during a slide
+  // it waits until the slide has finished.
+  if (panel == PANEL_TRANSIT && !sliding) {
+    fetch_tfl_arrivals();
+  }
+}
+
 const lv_img_dsc_t* choose_image(int code, int is_day) {
   switch (code) {
     // Clear sky
     case  0:
       return is_day
-        ? &image_sunny
-        : &image_clear_night;
+        ? ASSET_IMAGE(image_sunny)
+        : ASSET_IMAGE(image_clear_night);
 
     // Mainly clear
     case  1:
       return is_day
-        ? &image_mostly_sunny
-        : &image_mostly_clear_night;
+        ? ASSET_IMAGE(image_mostly_sunny)
+        : ASSET_IMAGE(image_mostly_clear_night);
 
     // Partly cloudy
     case  2:
       return is_day
-        ? &image_partly_cloudy
-        : &image_partly_cloudy_night;
+        ? ASSET_IMAGE(image_partly_cloudy)
+        : ASSET_IMAGE(image_partly_cloudy_night);
 
     // Overcast
     case  3:
-      return &image_cloudy;
+      return ASSET_IMAGE(image_cloudy);
 
     // Fog / mist
     case 45:
     case 48:
-      return &image_haze_fog_dust_smoke;
+      return ASSET_IMAGE(image_haze_fog_dust_smoke);
 
     // Drizzle (light → dense)
     case 51:
     case 53:
     case 55:
-      return &image_drizzle;
+      return ASSET_IMAGE(image_drizzle);
 
     // Freezing drizzle
     case 56:
     case 57:
-      return &image_sleet_hail;
+      return ASSET_IMAGE(image_sleet_hail);
 
     // Rain: slight showers
     case 61:
       return is_day
-        ? &image_scattered_showers_day
-        : &image_scattered_showers_night;
+        ? ASSET_IMAGE(image_scattered_showers_day)
+        : ASSET_IMAGE(image_scattered_showers_night);
 
     // Rain: moderate
     case 63:
-      return &image_showers_rain;
+      return ASSET_IMAGE(image_showers_rain);
 
     // Rain: heavy
     case 65:
-      return &image_heavy_rain;
+      return ASSET_IMAGE(image_heavy_rain);
 
     // Freezing rain
     case 66:
     case 67:
-      return &image_wintry_mix_rain_snow;
+      return ASSET_IMAGE(image_wintry_mix_rain_snow);
 
     // Snow fall (light, moderate, heavy) & snow showers (light)
     case 71:
     case 73:
     case 75:
     case 85:
-      return &image_snow_showers_snow;
+      return ASSET_IMAGE(image_snow_showers_snow);
 
     // Snow grains
     case 77:
-      return &image_flurries;
+      return ASSET_IMAGE(image_flurries);
 
     // Rain showers (slight → moderate)
     case 80:
     case 81:
       return is_day
-        ? &image_scattered_showers_day
-        : &image_scattered_showers_night;
+        ? ASSET_IMAGE(image_scattered_showers_day)
+        : ASSET_IMAGE(image_scattered_showers_night);
 
     // Rain showers: violent
     case 82:
-      return &image_heavy_rain;
+      return ASSET_IMAGE(image_heavy_rain);
 
     // Heavy snow showers
     case 86:
-      return &image_heavy_snow;
+      return ASSET_IMAGE(image_heavy_snow);
 
     // Thunderstorm (light)
     case 95:
       return is_day
-        ? &image_isolated_scattered_tstorms_day
-        : &image_isolated_scattered_tstorms_night;
+        ? ASSET_IMAGE(image_isolated_scattered_tstorms_day)
+        : ASSET_IMAGE(image_isolated_scattered_tstorms_night);
 
     // Thunderstorm with hail
     case 96:
     case 99:
-      return &image_strong_tstorms;
+      return ASSET_IMAGE(image_strong_tstorms);
 
     // Fallback for any other code
     default:
       return is_day
-        ? &image_mostly_cloudy_day
-        : &image_mostly_cloudy_night;
+        ? ASSET_IMAGE(image_mostly_cloudy_day)
+        : ASSET_IMAGE(image_mostly_cloudy_night);
   }
 }
 
@@ -2040,101 +3026,101 @@ const lv_img_dsc_t* choose_icon(int code, int is_day) {
     // Clear sky
     case  0:
       return is_day
-        ? &icon_sunny
-        : &icon_clear_night;
+        ? PANEL_ICON(icon_sunny)
+        : PANEL_ICON(icon_clear_night);
 
     // Mainly clear
     case  1:
       return is_day
-        ? &icon_mostly_sunny
-        : &icon_mostly_clear_night;
+        ? PANEL_ICON(icon_mostly_sunny)
+        : PANEL_ICON(icon_mostly_clear_night);
 
     // Partly cloudy
     case  2:
       return is_day
-        ? &icon_partly_cloudy
-        : &icon_partly_cloudy_night;
+        ? PANEL_ICON(icon_partly_cloudy)
+        : PANEL_ICON(icon_partly_cloudy_night);
 
     // Overcast
     case  3:
-      return &icon_cloudy;
+      return PANEL_ICON(icon_cloudy);
 
     // Fog / mist
     case 45:
     case 48:
-      return &icon_haze_fog_dust_smoke;
+      return PANEL_ICON(icon_haze_fog_dust_smoke);
 
     // Drizzle (light → dense)
     case 51:
     case 53:
     case 55:
-      return &icon_drizzle;
+      return PANEL_ICON(icon_drizzle);
 
     // Freezing drizzle
     case 56:
     case 57:
-      return &icon_sleet_hail;
+      return PANEL_ICON(icon_sleet_hail);
 
     // Rain: slight showers
     case 61:
       return is_day
-        ? &icon_scattered_showers_day
-        : &icon_scattered_showers_night;
+        ? PANEL_ICON(icon_scattered_showers_day)
+        : PANEL_ICON(icon_scattered_showers_night);
 
     // Rain: moderate
     case 63:
-      return &icon_showers_rain;
+      return PANEL_ICON(icon_showers_rain);
 
     // Rain: heavy
     case 65:
-      return &icon_heavy_rain;
+      return PANEL_ICON(icon_heavy_rain);
 
     // Freezing rain
     case 66:
     case 67:
-      return &icon_wintry_mix_rain_snow;
+      return PANEL_ICON(icon_wintry_mix_rain_snow);
 
     // Snow fall (light, moderate, heavy) & snow showers (light)
     case 71:
     case 73:
     case 75:
     case 85:
-      return &icon_snow_showers_snow;
+      return PANEL_ICON(icon_snow_showers_snow);
 
     // Snow grains
     case 77:
-      return &icon_flurries;
+      return PANEL_ICON(icon_flurries);
 
     // Rain showers (slight → moderate)
     case 80:
     case 81:
       return is_day
-        ? &icon_scattered_showers_day
-        : &icon_scattered_showers_night;
+        ? PANEL_ICON(icon_scattered_showers_day)
+        : PANEL_ICON(icon_scattered_showers_night);
 
     // Rain showers: violent
     case 82:
-      return &icon_heavy_rain;
+      return PANEL_ICON(icon_heavy_rain);
 
     // Heavy snow showers
     case 86:
-      return &icon_heavy_snow;
+      return PANEL_ICON(icon_heavy_snow);
 
     // Thunderstorm (light)
     case 95:
       return is_day
-        ? &icon_isolated_scattered_tstorms_day
-        : &icon_isolated_scattered_tstorms_night;
+        ? PANEL_ICON(icon_isolated_scattered_tstorms_day)
+        : PANEL_ICON(icon_isolated_scattered_tstorms_night);
 
     // Thunderstorm with hail
     case 96:
     case 99:
-      return &icon_strong_tstorms;
+      return PANEL_ICON(icon_strong_tstorms);
 
     // Fallback for any other code
     default:
       return is_day
-        ? &icon_mostly_cloudy_day
-        : &icon_mostly_cloudy_night;
+        ? PANEL_ICON(icon_mostly_cloudy_day)
+        : PANEL_ICON(icon_mostly_cloudy_night);
   }
 }
@@ -0,0 +1,202 @@
+#include <atomic>
+#include <stdio.h>
+#include "metrics.h"
+#include "stall.h"
+#include "str_builder.h"
+#include "traffic.h"
+
+// Durations: count, total and the longest since the last scrape. The total
+// is kept as whole seconds plus microseconds so it never wraps. Every writer
+// runs in the loop task, so each field has a single writer.
+struct Timing {
+  std::atomic<uint32_t> count;
+  std::atomic<uint32_t> sum_s;
+  std::atomic<uint32_t> sum_us;
+  std::atomic<uint32_t> max_us;
+};
+
+static const char *const fetch_names[METRICS_FETCH_COUNT] = {"weather", "geocode", "transit"};
+
+static Timing fetch_timing[METRICS_FETCH_COUNT];
+static std::atomic<uint32_t> fetch_errors[METRICS_FETCH_COUNT];
+static Timing timer_timing;
+static Timing frame_timing;
+static Timing ui_gap_timing;
+static Timing touch_timing;
+static std::atomic<uint32_t> wifi_reconnects(0);
+static std::atomic<uint32_t> touches(0);
+
+static void add_relaxed(std::atomic<uint32_t> &v, uint32_t n) {
+  v.store(v.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+static void timing_add(Timing &t, uint32_t us) {
+  uint32_t sum = t.sum_us.load(std::memory_order_relaxed) + us;
+  if (sum >= 1000000) {
+    add_relaxed(t.sum_s, sum / 1000000);
+    sum %= 1000000;
+  }
+  t.sum_us.store(sum, std::memory_order_relaxed);
+  add_relaxed(t.count, 1);
+  if (us > t.max_us.load(std::memory_order_relaxed)) t.max_us.store(us, std::memory_order_relaxed);
+}
+
+void metrics_fetch(MetricsFetch kind, uint32_t duration_ms, bool ok) {
+  if (kind < 0 || kind >= METRICS_FETCH_COUNT) return;
+  timing_add(fetch_timing[kind], duration_ms * 1000);
+  if (!ok) add_relaxed(fetch_errors[kind], 1);
+}
+
+void metrics_wifi_reconnect() {
+  add_relaxed(wifi_reconnects, 1);
+}
+
+void metrics_touch() {
+  add_relaxed(touches, 1);
+}
+
+void metrics_timer_handler(uint32_t duration_us) {
+  timing_add(timer_timing, duration_us);
+}
+
+void metrics_frame(uint32_t duration_us) {
+  timing_add(frame_timing, duration_us);
+}
+
+void metrics_ui_gap(uint32_t duration_us) {
+  timing_add(ui_gap_timing, duration_us);
+}
+
+void metrics_touch_latency(uint32_t duration_us) {
+  timing_add(touch_timing, duration_us);
+}
+
+static void emit_gauge(StrBuilder &out, const char *name, const char *help, long value) {
+  out.addf("# HELP %s %s\n# TYPE %s gauge\n%s %ld\n", name, help, name, name, value);
+}
+
+static void emit_counter(StrBuilder &out, const char *name, const char *help,
+                         unsigned long value) {
+  out.addf("# HELP %s %s\n# TYPE %s counter\n%s %lu\n", name, help, name, name, value);
+}
+
+// A summary family "<name>_seconds" with one series per Timing, then the
+// longest durations as the gauge "<name>_max_seconds"
+static void emit_timings(StrBuilder &out, const char *name, const char *help,
+                         Timing *timings, const char *const *labels, int count) {
+  out.addf("# HELP %s_seconds %s\n# TYPE %s_seconds summary\n", name, help, name);
+  for (int i = 0; i < count; i++) {
+    char label[32] = "";
+    if (labels) snprintf(label, sizeof(label), "{endpoint=\"%s\"}", labels[i]);
+    Timing &t = timings[i];
+    out.addf("%s_seconds_sum%s %lu.%06lu\n%s_seconds_count%s %lu\n", name, label,
+             (unsigned long)t.sum_s.load(std::memory_order_relaxed),
+             (unsigned long)t.sum_us.load(std::memory_order_relaxed), name, label,
+             (unsigned long)t.count.load(std::memory_order_relaxed));
+  }
+
+  out.addf("# HELP %s_max_seconds Longest since the last scrape\n# TYPE %s_max_seconds gauge\n",
+           name, name);
+  for (int i = 0; i < count; i++) {
+    char label[32] = "";
+    if (labels) snprintf(label, sizeof(label), "{endpoint=\"%s\"}", labels[i]);
+    unsigned long max_us = timings[i].max_us.exchange(0, std::memory_order_relaxed);
+    out.addf("%s_max_seconds%s %lu.%06lu\n", name, label, max_us / 1000000, max_us % 1000000);
+  }
+}
+
+size_t metrics_format(char *buf, size_t size, const MetricsGauges &g) {
+  StrBuilder out(buf, size);
+
+  emit_gauge(out, "aura_heap_free_bytes", "Free heap", g.heap_free);
+  emit_gauge(out, "aura_heap_min_free_bytes", "Lowest free heap since boot", g.heap_min_free);
+  emit_gauge(out, "aura_heap_largest_free_block_bytes", "Largest allocatable block",
+             g.heap_largest_block);
+  if (g.lvgl_mem_total) {
+    emit_gauge(out, "aura_lvgl_mem_total_bytes", "LVGL memory pool size", g.lvgl_mem_total);
+    emit_gauge(out, "aura_lvgl_mem_used_bytes", "LVGL memory pool in use", g.lvgl_mem_used);
+  }
+  if (g.main_screen_heap) {
+    emit_gauge(out, "aura_main_screen_heap_bytes", "Heap the main screen took when last built",
+               g.main_screen_heap);
+  }
+  emit_gauge(out, "aura_refresh_arena_bytes", "Scratch arena size", g.arena_capacity);
+  emit_gauge(out, "aura_refresh_arena_high_water_bytes", "Most scratch arena ever in use",
+             g.arena_high_water);
+  emit_counter(out, "aura_refresh_arena_failures_total", "Scratch allocations that did not fit",
+               g.arena_failures);
+  emit_gauge(out, "aura_wifi_rssi_dbm", "WiFi signal strength, 0 when disconnected", g.wifi_rssi);
+  emit_counter(out, "aura_wifi_reconnects_total", "WiFi reconnect attempts", wifi_reconnects.load());
+  emit_gauge(out, "aura_uptime_seconds", "Time since boot", g.uptime_s);
+  emit_counter(out, "aura_log_dropped_total", "Log lines dropped with the ring full", g.log_dropped);
+  emit_counter(out, "aura_touches_total", "Touch presses", touches.load());
+
+  emit_timings(out, "aura_fetch_duration", "HTTP fetch time, request to parsed body",
+               fetch_timing, fetch_names, METRICS_FETCH_COUNT);
+  out.addf("# HELP aura_fetch_errors_total Failed HTTP fetches\n"
+           "# TYPE aura_fetch_errors_total counter\n");
+  for (int i = 0; i < METRICS_FETCH_COUNT; i++) {
+    out.addf("aura_fetch_errors_total{endpoint=\"%s\"} %lu\n", fetch_names[i],
+             (unsigned long)fetch_errors[i].load());
+  }
+
+  // Per host, see traffic.h
+  const TrafficHost *hosts;
+  int host_n = traffic_hosts(&hosts);
+  out.addf("# HELP aura_http_requests_total HTTP requests made\n"
+           "# TYPE aura_http_requests_total counter\n");
+  for (int i = 0; i < host_n; i++) {
+    out.addf("aura_http_requests_total{host=\"%s\"} %lu\n", hosts[i].host,
+             (unsigned long)hosts[i].requests);
+  }
+  out.addf("# HELP aura_tls_handshakes_total TLS connections opened\n"
+           "# TYPE aura_tls_handshakes_total counter\n");
+  for (int i = 0; i < host_n; i++) {
+    out.addf("aura_tls_handshakes_total{host=\"%s\"} %lu\n", hosts[i].host,
+             (unsigned long)hosts[i].tls_handshakes);
+  }
+  out.addf("# HELP aura_http_sent_bytes_total Request lines and headers sent\n"
+           "# TYPE aura_http_sent_bytes_total counter\n");
+  for (int i = 0; i < host_n; i++) {
+    out.addf("aura_http_sent_bytes_total{host=\"%s\"} %llu\n", hosts[i].host,
+             (unsigned long long)hosts[i].bytes_out);
+  }
+  out.addf("# HELP aura_http_received_bytes_total Response bodies received\n"
+           "# TYPE aura_http_received_bytes_total counter\n");
+  for (int i = 0; i < host_n; i++) {
+    out.addf("aura_http_received_bytes_total{host=\"%s\"} %llu\n", hosts[i].host,
+             (unsigned long long)hosts[i].bytes_in);
+  }
+
+  emit_timings(out, "aura_lv_timer_handler_duration", "Time spent in lv_timer_handler()",
+               &timer_timing, nullptr, 1);
+  emit_timings(out, "aura_frame_duration", "Redraw time, first area rendered to last flushed",
+               &frame_timing, nullptr, 1);
+  emit_timings(out, "aura_ui_gap", "Time between lv_timer_handler() runs", &ui_gap_timing, nullptr, 1);
+  emit_timings(out, "aura_touch_latency", "Tap, from its click event to the end of the next redraw", &touch_timing,
+               nullptr, 1);
+
+  // Kept across soft resets, see stall.h
+  emit_counter(out, "aura_stalls_total", "Stages over the stall threshold since power-on",
+               stall_count());
+  const StallRecord *stalls;
+  int stall_n = stall_top(&stalls);
+  out.addf("# HELP aura_stall_seconds Longest stalls, by rank\n# TYPE aura_stall_seconds gauge\n");
+  for (int i = 0; i < stall_n; i++) {
+    out.addf("aura_stall_seconds{rank=\"%d\",stage=\"%s\",boot=\"%lu\"} %lu.%03lu\n", i + 1,
+             stalls[i].stage, (unsigned long)stalls[i].boot, (unsigned long)stalls[i].duration_ms / 1000,
+             (unsigned long)stalls[i].duration_ms % 1000);
+  }
+  out.addf("# HELP aura_stall_heap_free_bytes Free heap when each stall ended\n"
+           "# TYPE aura_stall_heap_free_bytes gauge\n");
+  for (int i = 0; i < stall_n; i++) {
+    out.addf("aura_stall_heap_free_bytes{rank=\"%d\",stage=\"%s\",boot=\"%lu\"} %lu\n", i + 1,
+             stalls[i].stage, (unsigned long)stalls[i].boot, (unsigned long)stalls[i].heap_free);
+  }
+  if (const char *stage = stall_reset_stage()) {
+    out.addf("# HELP aura_reset_stage_info Stage running when the last soft reset hit\n"
+             "# TYPE aura_reset_stage_info gauge\naura_reset_stage_info{stage=\"%s\"} 1\n", stage);
+  }
+
+  return out.length();
+}
@@ -0,0 +1,264 @@
+#include <string.h>
+#include "open_meteo.h"
+
+OpenMeteoParser::OpenMeteoParser(WeatherModel *models, int count)
+    : models_(models), count_(count) {
+  reset();
+}
+
+void OpenMeteoParser::reset() {
+  depth_ = 0;
+  loc_depth_ = 0;
+  object_mask_ = 0;
+  done_ = false;
+  in_string_ = false;
+  escape_ = false;
+  expect_key_ = false;
+  in_number_ = false;
+  key_len_ = 0;
+  section_ = SEC_NONE;
+  field_ = F_NONE;
+  index_ = 0;
+  current_ = nullptr;
+  parsed_ = 0;
+}
+
+void OpenMeteoParser::feed(const char *data, size_t len) {
+  for (size_t i = 0; i < len && !done_; i++) {
+    feed_char(data[i]);
+  }
+}
+
+void OpenMeteoParser::feed_char(char c) {
+  if (in_string_) {
+    // Only keys are kept; string values (time zone names, units) are skipped
+    if (escape_) {
+      escape_ = false;
+    } else if (c == '\\') {
+      escape_ = true;
+    } else if (c == '"') {
+      in_string_ = false;
+      if (expect_key_) end_key();
+    } else if (expect_key_ && key_len_ < sizeof(key_) - 1) {
+      key_[key_len_++] = c;
+    }
+    return;
+  }
+
+  if (in_number_) {
+    if (c >= '0' && c <= '9') {
+      if (frac_digits_ == 0) {
+        if (int_part_ < 400000000) int_part_ = int_part_ * 10 + (c - '0');
+      } else if (frac_digits_ <= 3) {
+        static const uint16_t weight[] = {0, 100, 10, 1};
+        frac_part_ += (c - '0') * weight[frac_digits_++];
+      }
+      return;
+    }
+    if (c == '.') {
+      frac_digits_ = 1;
+      return;
+    }
+    if (c == 'e' || c == 'E' || c == '+' || c == '-') return;  // Not produced by Open-Meteo
+    end_number();
+  }
+
+  switch (c) {
+    case '"':
+      in_string_ = true;
+      key_len_ = 0;
+      break;
+    case '{':
+      open_container(true);
+      break;
+    case '[':
+      open_container(false);
+      break;
+    case '}':
+    case ']':
+      close_container();
+      break;
+    case ':':
+      expect_key_ = false;
+      break;
+    case ',':
+      expect_key_ = (object_mask_ >> depth_) & 1;
+      if (depth_ == loc_depth_ + 2 && index_ < 255) index_++;
+      break;
+    default:
+      if (c == '-' || (c >= '0' && c <= '9')) {
+        in_number_ = true;
+        negative_ = (c == '-');
+        int_part_ = negative_ ? 0 : c - '0';
+        frac_part_ = 0;
+        frac_digits_ = 0;
+      }
+      // null, true and false leave the field at its default
+      break;
+  }
+}
+
+void OpenMeteoParser::open_container(bool object) {
+  if (depth_ == 0) loc_depth_ = object ? 1 : 2;
+  if (depth_ >= 31) return;
+  depth_++;
+  object_mask_ = object ? (object_mask_ | (1UL << depth_)) : (object_mask_ & ~(1UL << depth_));
+  expect_key_ = object;
+
+  if (depth_ == loc_depth_ && object) {
+    // A new location; everything defaults to zero until seen
+    current_ = (parsed_ < count_) ? &models_[parsed_] : nullptr;
+    if (current_) memset(current_, 0, sizeof(*current_));
+    section_ = SEC_NONE;
+  } else if (depth_ == loc_depth_ + 2) {
+    index_ = 0;
+  }
+}
+
+void OpenMeteoParser::close_container() {
+  if (depth_ == 0) return;
+
+  if (depth_ == loc_depth_ && ((object_mask_ >> depth_) & 1)) {
+    if (current_) {
+      current_->valid = true;
+      parsed_++;
+    }
+    current_ = nullptr;
+  }
+  if (depth_ == loc_depth_ + 1) section_ = SEC_NONE;
+
+  depth_--;
+  field_ = F_NONE;
+  expect_key_ = false;
+  if (depth_ == 0) done_ = true;
+}
+
+void OpenMeteoParser::end_key() {
+  key_[key_len_] = '\0';
+
+  if (depth_ == loc_depth_) {
+    if (strcmp(key_, "utc_offset_seconds") == 0) section_ = SEC_UTC_OFFSET;
+    else if (strcmp(key_, "current") == 0) section_ = SEC_CURRENT;
+    else if (strcmp(key_, "daily") == 0) section_ = SEC_DAILY;
+    else if (strcmp(key_, "hourly") == 0) section_ = SEC_HOURLY;
+    else section_ = SEC_NONE;
+  } else if (depth_ == loc_depth_ + 1 && section_ != SEC_NONE) {
+    if (strcmp(key_, "time") == 0) field_ = F_TIME;
+    else if (strcmp(key_, "temperature_2m") == 0) field_ = F_TEMP;
+    else if (strcmp(key_, "apparent_temperature") == 0) field_ = F_APPARENT;
+    else if (strcmp(key_, "temperature_2m_min") == 0) field_ = F_TEMP_MIN;
+    else if (strcmp(key_, "temperature_2m_max") == 0) field_ = F_TEMP_MAX;
+    else if (strcmp(key_, "weather_code") == 0) field_ = F_CODE;
+    else if (strcmp(key_, "is_day") == 0) field_ = F_IS_DAY;
+    else if (strcmp(key_, "sunrise") == 0) field_ = F_SUNRISE;
+    else if (strcmp(key_, "sunset") == 0) field_ = F_SUNSET;
+    else if (strcmp(key_, "precipitation") == 0) field_ = F_PRECIP;
+    else if (strcmp(key_, "precipitation_probability") == 0) field_ = F_PRECIP_PROB;
+    else field_ = F_NONE;
+  }
+}
+
+// The number just read, scaled by 10 or 100 and rounded
+int32_t OpenMeteoParser::fixed(int32_t scale) const {
+  int32_t v = (int32_t)int_part_ * scale + (frac_part_ * scale + 500) / 1000;
+  return negative_ ? -v : v;
+}
+
+void OpenMeteoParser::end_number() {
+  in_number_ = false;
+  if (!current_) return;
+  WeatherModel &m = *current_;
+  int32_t whole = negative_ ? -(int32_t)int_part_ : (int32_t)int_part_;
+
+  if (section_ == SEC_UTC_OFFSET && depth_ == loc_depth_) {
+    m.utc_offset_seconds = whole;
+  } else if (section_ == SEC_CURRENT && depth_ == loc_depth_ + 1) {
+    switch (field_) {
+      case F_TEMP: m.t_now = fixed(10); break;
+      case F_APPARENT: m.t_feels = fixed(10); break;
+      case F_CODE: m.code_now = whole; break;
+      case F_IS_DAY: m.is_day = whole; break;
+      default: break;
+    }
+  } else if (section_ == SEC_DAILY && depth_ == loc_depth_ + 2 && index_ < FORECAST_DAYS) {
+    DailyForecast &d = m.daily[index_];
+    switch (field_) {
+      case F_TIME: d.time = int_part_; break;
+      case F_TEMP_MIN: d.t_min = fixed(10); break;
+      case F_TEMP_MAX: d.t_max = fixed(10); break;
+      case F_CODE: d.code = whole; break;
+      case F_SUNRISE: if (index_ == 0) m.sunrise = int_part_; break;
+      case F_SUNSET: if (index_ == 0) m.sunset = int_part_; break;
+      default: break;
+    }
+  } else if (section_ == SEC_HOURLY && depth_ == loc_depth_ + 2 && index_ < FORECAST_HOURS) {
+    HourlyForecast &h = m.hourly[index_];
+    switch (field_) {
+      case F_TIME: h.time = int_part_; break;
+      case F_TEMP: h.temp = fixed(10); break;
+      case F_PRECIP: {
+        int32_t p = fixed(100);
+        h.precip = (p < 0) ? 0 : (p > 0xFFFF) ? 0xFFFF : p;
+        break;
+      }
+      case F_PRECIP_PROB: h.precip_prob = whole; break;
+      case F_CODE: h.code = whole; break;
+      case F_IS_DAY: h.is_day = whole; break;
+      default: break;
+    }
+  }
+}
+
+int32_t fixed_round(int32_t value, int32_t scale) {
+  return (value < 0) ? -((-value + scale / 2) / scale) : (value + scale / 2) / scale;
+}
+
+size_t format_int(char *buf, size_t size, int32_t value) {
+  char digits[12];
+  size_t n = 0;
+  uint32_t mag = (value < 0) ? (uint32_t)(-(int64_t)value) : (uint32_t)value;
+  do {
+    digits[n++] = '0' + mag % 10;
+    mag /= 10;
+  } while (mag);
+  if (value < 0) digits[n++] = '-';
+
+  size_t len = 0;
+  while (n > 0 && len + 1 < size) buf[len++] = digits[--n];
+  if (size > 0) buf[len] = '\0';
+  return len;
+}
+
+size_t format_fixed(char *buf, size_t size, int32_t value, int decimals) {
+  int32_t scale = 1;
+  for (int i = 0; i < decimals; i++) scale *= 10;
+
+  uint32_t mag = (value < 0) ? (uint32_t)(-(int64_t)value) : (uint32_t)value;
+  size_t len = 0;
+  if (value < 0 && len + 1 < size) buf[len++] = '-';
+  len += format_int(buf + len, size - len, mag / scale);
+
+  if (decimals > 0 && len + 1 + decimals < size) {
+    buf[len++] = '.';
+    uint32_t frac = mag % scale;
+    for (int i = decimals - 1; i >= 0; i--) {
+      buf[len + i] = '0' + frac % 10;
+      frac /= 10;
+    }
+    len += decimals;
+    buf[len] = '\0';
+  }
+  return len;
+}
+
+size_t format_precip(char *buf, size_t size, uint16_t hundredths, bool inches) {
+  if (hundredths < 10) {
+    if (size > 0) buf[0] = '\0';
+    return 0;
+  }
+  size_t len = format_fixed(buf, size, fixed_round(hundredths, 10), 1);
+  const char *unit = inches ? "in" : "mm";
+  while (*unit && len + 1 < size) buf[len++] = *unit++;
+  buf[len] = '\0';
+  return len;
+}
@@ -0,0 +1,8 @@
+#include "schedule.h"
+
+bool Interval::due(uint32_t now) {
+  // Unsigned difference, so the 49-day millis() wrap is harmless
+  if (now - last_ < period_) return false;
+  last_ = now;
+  return true;
+}
@@ -0,0 +1,171 @@
+#include <stdio.h>
+#include <string.h>
+#include "soak.h"
+#include "str_builder.h"
+
+#define SOAK_FRAG_TOLERANCE 10  // Percentage points
+
+// Cheap deterministic noise for the synthetic forecasts
+static uint32_t mix(uint32_t x) {
+  x ^= x >> 16;
+  x *= 0x7feb352dU;
+  x ^= x >> 15;
+  x *= 0x846ca68bU;
+  x ^= x >> 16;
+  return x;
+}
+
+// Tenths as a JSON number, e.g. -35 -> "-3.5"
+static void add_tenths(StrBuilder &out, int32_t tenths) {
+  if (tenths < 0) {
+    out.add('-');
+    tenths = -tenths;
+  }
+  out.add_int(tenths / 10).add('.').add_int(tenths % 10);
+}
+
+// Comma separated array of count values from next(i)
+template <typename F>
+static void add_array(StrBuilder &out, const char *key, int count, F next) {
+  out.add('"').add(key).add("\":[");
+  for (int i = 0; i < count; i++) {
+    if (i) out.add(',');
+    next(i);
+  }
+  out.add(']');
+}
+
+size_t soak_forecast_json(char *buf, size_t size, int count, uint32_t seed, uint32_t now) {
+  StrBuilder out(buf, size);
+  uint32_t midnight = now - now % 86400;
+  uint32_t hour = now - now % 3600;
+
+  if (count > 1) out.add('[');
+  for (int loc = 0; loc < count; loc++) {
+    uint32_t r = mix(seed * 31 + loc);
+    auto temp = [&](int i) { return (int32_t)(mix(r + i) % 500) - 150; };  // -15.0 to 34.9
+
+    if (loc) out.add(',');
+    out.add("{\"latitude\":51.5,\"longitude\":-0.12,\"utc_offset_seconds\":")
+        .add_int((int32_t)(r % 5) * 3600)
+        .add(",\"timezone\":\"Europe/London\",\"current\":{\"time\":")
+        .add_int(now)
+        .add(",\"temperature_2m\":");
+    add_tenths(out, temp(0));
+    out.add(",\"apparent_temperature\":");
+    add_tenths(out, temp(1));
+    out.add(",\"is_day\":").add_int(r & 1).add(",\"weather_code\":").add_int(mix(r) % 100).add("},");
+
+    out.add("\"daily\":{");
+    add_array(out, "time", 7, [&](int i) { out.add_int(midnight + i * 86400); });
+    out.add(',');
+    add_array(out, "temperature_2m_min", 7, [&](int i) { add_tenths(out, temp(i) - 50); });
+    out.add(',');
+    add_array(out, "temperature_2m_max", 7, [&](int i) { add_tenths(out, temp(i)); });
+    out.add(',');
+    add_array(out, "weather_code", 7, [&](int i) { out.add_int(mix(r + i * 7) % 100); });
+    out.add(',');
+    add_array(out, "sunrise", 7, [&](int i) { out.add_int(midnight + i * 86400 + 6 * 3600 + r % 3600); });
+    out.add(',');
+    add_array(out, "sunset", 7, [&](int i) { out.add_int(midnight + i * 86400 + 19 * 3600 + r % 3600); });
+    out.add("},\"hourly\":{");
+    add_array(out, "time", 7, [&](int i) { out.add_int(hour + i * 3600); });
+    out.add(',');
+    add_array(out, "temperature_2m", 7, [&](int i) { add_tenths(out, temp(i + 3)); });
+    out.add(',');
+    add_array(out, "precipitation_probability", 7, [&](int i) { out.add_int(mix(r + i * 13) % 101); });
+    out.add(',');
+    add_array(out, "precipitation", 7, [&](int i) { add_tenths(out, (int32_t)(mix(r + i * 17) % 120)); });
+    out.add(',');
+    add_array(out, "is_day", 7, [&](int i) { out.add_int((r + i) & 1); });
+    out.add(',');
+    add_array(out, "weather_code", 7, [&](int i) { out.add_int(mix(r + i * 19) % 100); });
+    out.add("}}");
+  }
+  if (count > 1) out.add(']');
+
+  return out.truncated() ? 0 : out.length();
+}
+
+size_t soak_arrivals_json(char *buf, size_t size, int count, uint32_t seed) {
+  static const char *const lines[] = {"73", "38", "N73", "Victoria", "Piccadilly"};
+  static const char *const places[] = {"Oxford Circus", "Stoke Newington", "Victoria", "Walthamstow Central",
+                                       "Cockfosters"};
+  const int n = sizeof(lines) / sizeof(lines[0]);
+  StrBuilder out(buf, size);
+
+  out.add('[');
+  for (int i = 0; i < count; i++) {
+    uint32_t r = mix(seed * 31 + i);
+    if (i) out.add(',');
+    out.add("{\"$type\":\"Tfl.Api.Presentation.Entities.Prediction, Tfl.Api.Presentation.Entities\",\"lineName\":\"")
+        .add(lines[r % n])
+        .add("\",\"destinationName\":\"")
+        .add(places[(r >> 8) % n])
+        .add("\",\"towards\":\"")
+        .add(places[(r >> 16) % n])
+        .add("\",\"timeToStation\":")
+        .add_int((r >> 4) % 1800)
+        .add('}');
+  }
+  out.add(']');
+
+  return out.truncated() ? 0 : out.length();
+}
+
+SoakMonitor::SoakMonitor(uint32_t window, uint32_t warmup_windows, uint32_t tolerance)
+    : window_(window ? window : 1), warmup_windows_(warmup_windows), tolerance_(tolerance), samples_(0),
+      windows_(0), peak_in_use_(0), last_(), window_floor_(UINT32_MAX), window_lvgl_floor_(UINT32_MAX),
+      window_frag_(0), baseline_floor_(0), baseline_lvgl_floor_(0), baseline_frag_(0), failed_(false),
+      reason_() {}
+
+uint8_t SoakMonitor::frag_pct(const HeapSample &s) {
+  if (s.free == 0) return 100;
+  return (uint8_t)(100 - (uint64_t)s.largest_free * 100 / s.free);
+}
+
+bool SoakMonitor::sample(const HeapSample &s) {
+  if (failed_) return false;
+  samples_++;
+  last_ = s;
+  if (s.in_use > peak_in_use_) peak_in_use_ = s.in_use;
+  if (s.in_use < window_floor_) window_floor_ = s.in_use;
+  if (s.lvgl_used < window_lvgl_floor_) window_lvgl_floor_ = s.lvgl_used;
+  uint8_t frag = frag_pct(s);
+  if (s.lvgl_frag_pct > frag) frag = s.lvgl_frag_pct;
+  if (frag > window_frag_) window_frag_ = frag;
+  if (samples_ % window_) return true;
+
+  if (windows_++ < warmup_windows_) {
+    if (window_floor_ > baseline_floor_) baseline_floor_ = window_floor_;
+    if (window_lvgl_floor_ > baseline_lvgl_floor_) baseline_lvgl_floor_ = window_lvgl_floor_;
+    if (window_frag_ > baseline_frag_) baseline_frag_ = window_frag_;
+  } else if (window_floor_ > baseline_floor_ + tolerance_) {
+    snprintf(reason_, sizeof(reason_), "heap floor grew from %lu to %lu bytes", (unsigned long)baseline_floor_,
+             (unsigned long)window_floor_);
+    failed_ = true;
+  } else if (window_lvgl_floor_ > baseline_lvgl_floor_ + tolerance_) {
+    snprintf(reason_, sizeof(reason_), "LVGL pool floor grew from %lu to %lu bytes",
+             (unsigned long)baseline_lvgl_floor_, (unsigned long)window_lvgl_floor_);
+    failed_ = true;
+  } else if (window_frag_ > baseline_frag_ + SOAK_FRAG_TOLERANCE) {
+    snprintf(reason_, sizeof(reason_), "fragmentation rose from %u%% to %u%%", baseline_frag_, window_frag_);
+    failed_ = true;
+  }
+
+  window_floor_ = UINT32_MAX;
+  window_lvgl_floor_ = UINT32_MAX;
+  window_frag_ = 0;
+  return !failed_;
+}
+
+void SoakMonitor::report(char *buf, size_t size) const {
+  if (failed_) {
+    snprintf(buf, size, "FAILED after %lu cycles: %s", (unsigned long)samples_, reason_);
+    return;
+  }
+  snprintf(buf, size, "%lu cycles, heap %lu in use (peak %lu, baseline floor %lu), largest free %lu of %lu (%u%%)%s",
+           (unsigned long)samples_, (unsigned long)last_.in_use, (unsigned long)peak_in_use_,
+           (unsigned long)baseline_floor_, (unsigned long)last_.largest_free, (unsigned long)last_.free,
+           frag_pct(last_), windows_ < warmup_windows_ ? ", warming up" : "");
+}
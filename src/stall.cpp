@@ -0,0 +1,155 @@
+#include <stddef.h>
+#include <string.h>
+#include "stall.h"
+#include "log.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <esp_attr.h>
+#include <esp_heap_caps.h>
+#include <esp_system.h>
+#define STALL_RETAINED RTC_NOINIT_ATTR
+#else
+#include <chrono>
+#define STALL_RETAINED
+#endif
+
+#define STALL_MAGIC 0x4c415453  // "STAL"
+
+// Kept in RTC slow memory, which a soft reset leaves alone. Power-on fills
+// it with noise, hence the checksum.
+struct StallRetained {
+  uint32_t magic;
+  uint32_t boot;
+  uint32_t count;
+  uint32_t top_count;
+  StallRecord top[STALL_TOP_N];
+  uint32_t checksum;             // Over everything above
+  char active[STALL_NAME_MAX];   // Innermost stage running, "" between stages
+};
+
+static STALL_RETAINED StallRetained retained;
+static char reset_stage[STALL_NAME_MAX];
+
+struct StallFrame {
+  const char *stage;
+  uint32_t start_us;
+  uint32_t child_us;  // Spent in stages nested inside this one
+};
+
+static StallFrame frames[STALL_DEPTH];
+static int depth = 0;  // Can exceed STALL_DEPTH; the extra levels are not timed
+static uint32_t threshold_us = 100000;
+
+static uint32_t now_us() {
+#ifdef ARDUINO
+  return micros();
+#else
+  using namespace std::chrono;
+  return (uint32_t)duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+static uint32_t retained_checksum() {
+  // FNV-1a
+  const uint8_t *p = (const uint8_t *)&retained;
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < offsetof(StallRetained, checksum); i++) {
+    hash = (hash ^ p[i]) * 16777619u;
+  }
+  return hash;
+}
+
+static void set_active(const char *stage) {
+  strncpy(retained.active, stage, STALL_NAME_MAX - 1);
+  retained.active[STALL_NAME_MAX - 1] = '\0';
+}
+
+static void record(const char *stage, uint32_t duration_ms) {
+  StallRecord rec = {};
+  strncpy(rec.stage, stage, STALL_NAME_MAX - 1);
+  rec.duration_ms = duration_ms;
+#ifdef ARDUINO
+  rec.heap_free = ESP.getFreeHeap();
+  rec.heap_largest = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  rec.uptime_s = millis() / 1000;
+#endif
+  rec.boot = retained.boot;
+  LOG_W("Stall: %s ran %lu ms (heap %lu free, %lu largest)", rec.stage, (unsigned long)duration_ms,
+        (unsigned long)rec.heap_free, (unsigned long)rec.heap_largest);
+
+  retained.count++;
+  int i = retained.top_count < STALL_TOP_N ? retained.top_count++ : STALL_TOP_N;
+  while (i > 0 && retained.top[i - 1].duration_ms < duration_ms) {
+    if (i < STALL_TOP_N) retained.top[i] = retained.top[i - 1];
+    i--;
+  }
+  if (i < STALL_TOP_N) retained.top[i] = rec;
+  retained.checksum = retained_checksum();
+}
+
+void stall_enter(const char *stage) {
+  if (depth < STALL_DEPTH) {
+    frames[depth] = {stage, now_us(), 0};
+    set_active(stage);
+  }
+  depth++;
+}
+
+void stall_exit() {
+  if (depth == 0) return;
+  depth--;
+  if (depth >= STALL_DEPTH) return;
+
+  const StallFrame &frame = frames[depth];
+  uint32_t elapsed = now_us() - frame.start_us;
+  uint32_t self = elapsed - frame.child_us;
+  if (depth > 0) frames[depth - 1].child_us += elapsed;
+  set_active(depth > 0 ? frames[depth - 1].stage : "");
+
+  if (self >= threshold_us) record(frame.stage, self / 1000);
+}
+
+void stall_init(uint32_t threshold_ms) {
+  threshold_us = threshold_ms * 1000;
+  bool valid = retained.magic == STALL_MAGIC && retained.checksum == retained_checksum() &&
+               retained.top_count <= STALL_TOP_N;
+#ifdef ARDUINO
+  esp_reset_reason_t reason = esp_reset_reason();
+  if (reason == ESP_RST_POWERON) valid = false;
+#endif
+
+  if (valid) {
+    retained.active[STALL_NAME_MAX - 1] = '\0';
+    strcpy(reset_stage, retained.active);
+    retained.boot++;
+  } else {
+    memset(&retained, 0, sizeof(retained));
+    retained.magic = STALL_MAGIC;
+  }
+  retained.active[0] = '\0';
+  retained.checksum = retained_checksum();
+
+#ifdef ARDUINO
+  if (reset_stage[0]) LOG_W("Reset (reason %d) while running %s", (int)reason, reset_stage);
+#endif
+  for (uint32_t i = 0; i < retained.top_count; i++) {
+    const StallRecord &rec = retained.top[i];
+    LOG_I("Stall #%lu: %s ran %lu ms at %lu s in boot %lu (heap %lu free, %lu largest)",
+          (unsigned long)i + 1, rec.stage, (unsigned long)rec.duration_ms, (unsigned long)rec.uptime_s,
+          (unsigned long)rec.boot, (unsigned long)rec.heap_free, (unsigned long)rec.heap_largest);
+  }
+}
+
+int stall_top(const StallRecord **records) {
+  *records = retained.top;
+  return (int)retained.top_count;
+}
+
+uint32_t stall_count() {
+  return retained.count;
+}
+
+const char *stall_reset_stage() {
+  return reset_stage[0] ? reset_stage : nullptr;
+}
@@ -0,0 +1,86 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include "str_builder.h"
+
+StrBuilder::StrBuilder(char *buf, size_t size) : buf_(buf), size_(size), len_(0), truncated_(false) {
+  if (size_ > 0) buf_[0] = '\0';
+}
+
+void StrBuilder::clear() {
+  len_ = 0;
+  truncated_ = false;
+  if (size_ > 0) buf_[0] = '\0';
+}
+
+StrBuilder &StrBuilder::add(char c) {
+  if (len_ + 1 < size_) {
+    buf_[len_++] = c;
+    buf_[len_] = '\0';
+  } else {
+    truncated_ = true;
+  }
+  return *this;
+}
+
+StrBuilder &StrBuilder::add(const char *s) {
+  while (*s && len_ + 1 < size_) buf_[len_++] = *s++;
+  if (*s) truncated_ = true;
+  if (size_ > 0) buf_[len_] = '\0';
+  return *this;
+}
+
+StrBuilder &StrBuilder::add_int(int32_t value) {
+  return add_int(value, 1);
+}
+
+StrBuilder &StrBuilder::add_int(int32_t value, int min_digits) {
+  char digits[12];
+  int n = 0;
+  uint32_t mag = (value < 0) ? (uint32_t)(-(int64_t)value) : (uint32_t)value;
+  do {
+    digits[n++] = '0' + mag % 10;
+    mag /= 10;
+  } while (mag);
+  while (n < min_digits && n < (int)sizeof(digits) - 1) digits[n++] = '0';
+
+  if (value < 0) add('-');
+  while (n > 0) add(digits[--n]);
+  return *this;
+}
+
+StrBuilder &StrBuilder::addf(const char *fmt, ...) {
+  if (len_ + 1 >= size_) {
+    if (*fmt) truncated_ = true;
+    return *this;
+  }
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(buf_ + len_, size_ - len_, fmt, args);
+  va_end(args);
+  if (n <= 0) return *this;
+  if (len_ + n < size_) {
+    len_ += n;
+  } else {
+    len_ = size_ - 1;
+    truncated_ = true;
+  }
+  return *this;
+}
+
+StrBuilder &StrBuilder::add_urlencoded(const char *s) {
+  static const char hex[] = "0123456789ABCDEF";
+  for (; *s; s++) {
+    unsigned char c = *s;
+    // Unreserved characters according to RFC 3986
+    if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '-' || c == '_' ||
+        c == '.' || c == '~') {
+      add((char)c);
+    } else if (len_ + 3 < size_) {
+      add('%').add(hex[c >> 4]).add(hex[c & 0xf]);
+    } else {
+      truncated_ = true;  // Never leave half an escape
+      break;
+    }
+  }
+  return *this;
+}
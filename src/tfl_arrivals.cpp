@@ -0,0 +1,230 @@
+#include <string.h>
+#include "tfl_arrivals.h"
+
+// Copy a UTF-8 string, truncating on a character boundary
+static void copy_utf8(char *dst, size_t size, const char *src) {
+  size_t len = strlen(src);
+  if (len >= size) {
+    len = size - 1;
+    while (len > 0 && ((unsigned char)src[len] & 0xC0) == 0x80) len--;
+  }
+  memcpy(dst, src, len);
+  dst[len] = '\0';
+}
+
+void ArrivalTopK::offer(const ArrivalInfo &arrival) {
+  if (count_ < ARRIVALS_SHOWN) {
+    int i = count_++;
+    while (i > 0) {
+      int parent = (i - 1) / 2;
+      if (heap_[parent].timeToStation >= arrival.timeToStation) break;
+      heap_[i] = heap_[parent];
+      i = parent;
+    }
+    heap_[i] = arrival;
+  } else if (arrival.timeToStation < heap_[0].timeToStation) {
+    heap_[0] = arrival;
+    sift_down(0);
+  }
+}
+
+void ArrivalTopK::sift_down(int i) {
+  ArrivalInfo item = heap_[i];
+  for (;;) {
+    int child = 2 * i + 1;
+    if (child >= count_) break;
+    if (child + 1 < count_ && heap_[child + 1].timeToStation > heap_[child].timeToStation) child++;
+    if (heap_[child].timeToStation <= item.timeToStation) break;
+    heap_[i] = heap_[child];
+    i = child;
+  }
+  heap_[i] = item;
+}
+
+int ArrivalTopK::take_sorted(ArrivalInfo *out) {
+  int n = count_;
+  for (int i = n - 1; i >= 0; i--) {
+    out[i] = heap_[0];
+    heap_[0] = heap_[--count_];
+    if (count_ > 0) sift_down(0);
+  }
+  return n;
+}
+
+ArrivalParser::ArrivalParser(ArrivalTopK &top, bool prefer_towards)
+    : top_(top), prefer_towards_(prefer_towards) {
+  reset();
+}
+
+void ArrivalParser::reset() {
+  depth_ = 0;
+  started_ = false;
+  done_ = false;
+  in_string_ = false;
+  escape_ = false;
+  unicode_digits_ = 0;
+  expect_key_ = false;
+  in_number_ = false;
+  token_len_ = 0;
+  field_ = FIELD_NONE;
+  parsed_ = 0;
+}
+
+void ArrivalParser::feed(const char *data, size_t len) {
+  for (size_t i = 0; i < len && !done_; i++) {
+    feed_char(data[i]);
+  }
+}
+
+void ArrivalParser::feed_char(char c) {
+  if (in_string_) {
+    if (unicode_digits_ > 0) {
+      int v = (c >= '0' && c <= '9') ? c - '0'
+            : (c >= 'a' && c <= 'f') ? c - 'a' + 10
+            : (c >= 'A' && c <= 'F') ? c - 'A' + 10 : 0;
+      unicode_value_ = (unicode_value_ << 4) | v;
+      if (--unicode_digits_ == 0) {
+        // Encode the BMP code point as UTF-8; surrogate pairs become '?'
+        uint16_t cp = unicode_value_;
+        if (cp < 0x80) {
+          string_char((char)cp);
+        } else if (cp < 0x800) {
+          string_char((char)(0xC0 | (cp >> 6)));
+          string_char((char)(0x80 | (cp & 0x3F)));
+        } else if (cp >= 0xD800 && cp <= 0xDFFF) {
+          string_char('?');
+        } else {
+          string_char((char)(0xE0 | (cp >> 12)));
+          string_char((char)(0x80 | ((cp >> 6) & 0x3F)));
+          string_char((char)(0x80 | (cp & 0x3F)));
+        }
+      }
+    } else if (escape_) {
+      escape_ = false;
+      switch (c) {
+        case 'u': unicode_digits_ = 4; unicode_value_ = 0; break;
+        case 'n': case 'r': case 't': case 'b': case 'f': string_char(' '); break;
+        default: string_char(c); break;
+      }
+    } else if (c == '\\') {
+      escape_ = true;
+    } else if (c == '"') {
+      in_string_ = false;
+      end_string();
+    } else {
+      string_char(c);
+    }
+    return;
+  }
+
+  if (in_number_) {
+    if ((c >= '0' && c <= '9') || c == '.' || c == '-' || c == '+' || c == 'e' || c == 'E') {
+      // Only the integer part is kept; timeToStation is whole seconds
+      if (c == '.' || c == 'e' || c == 'E') {
+        fraction_ = true;
+      } else if (c >= '0' && c <= '9' && !fraction_ && number_ < 100000000) {
+        number_ = number_ * 10 + (c - '0');
+      }
+      return;
+    }
+    end_number();
+  }
+
+  switch (c) {
+    case '"':
+      in_string_ = true;
+      token_len_ = 0;
+      break;
+    case '{':
+    case '[':
+      if (depth_ == 0) started_ = true;
+      depth_++;
+      if (depth_ == 2 && c == '{') begin_arrival();
+      break;
+    case '}':
+    case ']':
+      if (depth_ == 0) break;
+      if (depth_ == 2 && c == '}') end_arrival();
+      depth_--;
+      if (depth_ == 0 && started_) done_ = true;
+      field_ = FIELD_NONE;
+      break;
+    case ':':
+      if (depth_ == 2) expect_key_ = false;
+      break;
+    case ',':
+      if (depth_ == 2) {
+        expect_key_ = true;
+        field_ = FIELD_NONE;
+      }
+      break;
+    default:
+      if (depth_ == 2 && !expect_key_ && field_ == FIELD_TIME && (c == '-' || (c >= '0' && c <= '9'))) {
+        in_number_ = true;
+        fraction_ = false;
+        negative_ = (c == '-');
+        number_ = negative_ ? 0 : c - '0';
+      }
+      break;
+  }
+}
+
+void ArrivalParser::string_char(char c) {
+  // Only arrival-level keys and string fields are captured
+  if (depth_ != 2 || (!expect_key_ && (field_ == FIELD_NONE || field_ == FIELD_TIME))) return;
+  if (token_len_ < sizeof(token_) - 1) token_[token_len_++] = c;
+}
+
+void ArrivalParser::end_string() {
+  if (depth_ != 2) return;
+  token_[token_len_] = '\0';
+
+  if (expect_key_) {
+    if (strcmp(token_, "lineName") == 0) field_ = FIELD_LINE;
+    else if (strcmp(token_, "destinationName") == 0) field_ = FIELD_DESTINATION;
+    else if (strcmp(token_, "towards") == 0) field_ = FIELD_TOWARDS;
+    else if (strcmp(token_, "timeToStation") == 0) field_ = FIELD_TIME;
+    else field_ = FIELD_NONE;
+    return;
+  }
+
+  switch (field_) {
+    case FIELD_LINE: copy_utf8(current_.line, sizeof(current_.line), token_); break;
+    case FIELD_DESTINATION: copy_utf8(current_.destination, sizeof(current_.destination), token_); break;
+    case FIELD_TOWARDS: copy_utf8(towards_, sizeof(towards_), token_); break;
+    default: break;
+  }
+  field_ = FIELD_NONE;
+}
+
+void ArrivalParser::end_number() {
+  in_number_ = false;
+  if (field_ == FIELD_TIME) {
+    current_.timeToStation = negative_ ? -number_ : number_;
+    has_time_ = true;
+  }
+  field_ = FIELD_NONE;
+}
+
+void ArrivalParser::begin_arrival() {
+  expect_key_ = true;
+  field_ = FIELD_NONE;
+  current_.line[0] = '\0';
+  current_.destination[0] = '\0';
+  towards_[0] = '\0';
+  has_time_ = false;
+}
+
+void ArrivalParser::end_arrival() {
+  if (in_number_) end_number();
+  if (!has_time_) return;
+
+  if (prefer_towards_ && towards_[0]) {
+    copy_utf8(current_.destination, sizeof(current_.destination), towards_);
+  }
+  if (!current_.line[0]) strcpy(current_.line, "?");
+  if (!current_.destination[0]) strcpy(current_.destination, "?");
+
+  top_.offer(current_);
+  parsed_++;
+}
@@ -0,0 +1,116 @@
+#include <stdio.h>
+#include <string.h>
+#include "trace.h"
+
+#ifdef ARDUINO
+#include <esp_timer.h>
+#else
+#include <chrono>
+#endif
+
+struct TraceEvent {
+  const char *name;
+  uint64_t start_us;
+  uint32_t duration_us;
+};
+
+static TraceEvent boot_events[TRACE_BOOT_EVENTS];
+static int boot_count = 0;
+static int boot_lost = 0;  // Boot spans that did not fit
+static bool booting = true;
+
+static TraceEvent ring_events[TRACE_RING_EVENTS];
+static uint32_t ring_next = 0;  // Total recorded; the ring holds the last ones
+
+struct TraceOpen {
+  const char *name;
+  uint64_t start_us;
+};
+
+static TraceOpen open_spans[TRACE_DEPTH];
+static int depth = 0;  // Can exceed TRACE_DEPTH; the extra levels are not traced
+
+uint64_t trace_now_us() {
+#ifdef ARDUINO
+  return (uint64_t)esp_timer_get_time();
+#else
+  using namespace std::chrono;
+  static const steady_clock::time_point start = steady_clock::now();
+  return (uint64_t)duration_cast<microseconds>(steady_clock::now() - start).count();
+#endif
+}
+
+void trace_complete(const char *name, uint64_t start_us, uint32_t duration_us) {
+  TraceEvent event = {name, start_us, duration_us};
+  if (booting) {
+    if (boot_count < TRACE_BOOT_EVENTS) boot_events[boot_count++] = event;
+    else boot_lost++;
+  } else {
+    ring_events[ring_next++ % TRACE_RING_EVENTS] = event;
+  }
+}
+
+void trace_begin(const char *name) {
+  if (depth < TRACE_DEPTH) open_spans[depth] = {name, trace_now_us()};
+  depth++;
+}
+
+void trace_end() {
+  if (depth == 0) return;
+  depth--;
+  if (depth >= TRACE_DEPTH) return;
+  const TraceOpen &span = open_spans[depth];
+  trace_complete(span.name, span.start_us, (uint32_t)(trace_now_us() - span.start_us));
+}
+
+void trace_boot_done() {
+  booting = false;
+}
+
+// Collects output into a buffer and hands it to the sink when it fills
+struct TraceWriter {
+  TraceSink sink;
+  void *ctx;
+  char buf[512];
+  size_t len;
+  bool first;
+};
+
+static void writer_flush(TraceWriter &w) {
+  if (w.len) w.sink(w.buf, w.len, w.ctx);
+  w.len = 0;
+}
+
+static void writer_add(TraceWriter &w, const char *text) {
+  size_t n = strlen(text);
+  if (w.len + n > sizeof(w.buf)) writer_flush(w);
+  memcpy(w.buf + w.len, text, n);
+  w.len += n;
+}
+
+static void write_event(TraceWriter &w, const TraceEvent &event, const char *cat) {
+  char line[160];
+  snprintf(line, sizeof(line),
+           "%s\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%llu,\"dur\":%lu,\"pid\":1,\"tid\":1}",
+           w.first ? "" : ",", event.name, cat, (unsigned long long)event.start_us,
+           (unsigned long)event.duration_us);
+  w.first = false;
+  writer_add(w, line);
+}
+
+void trace_write_json(TraceSink sink, void *ctx) {
+  TraceWriter w = {sink, ctx, {}, 0, true};
+  writer_add(w, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+  writer_add(w, "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"loop\"}}");
+  w.first = false;
+
+  for (int i = 0; i < boot_count; i++) write_event(w, boot_events[i], "boot");
+  uint32_t oldest = ring_next > TRACE_RING_EVENTS ? ring_next - TRACE_RING_EVENTS : 0;
+  for (uint32_t i = oldest; i < ring_next; i++) write_event(w, ring_events[i % TRACE_RING_EVENTS], "run");
+
+  char tail[96];
+  snprintf(tail, sizeof(tail), "\n],\"otherData\":{\"boot_spans_lost\":%d,\"run_spans_lost\":%lu}}\n", boot_lost,
+           (unsigned long)oldest);
+  writer_add(w, tail);
+  writer_flush(w);
+}
@@ -0,0 +1,122 @@
+#include <stdio.h>
+#include <string.h>
+#include "str_builder.h"
+#include "traffic.h"
+
+#define DAY_MS 86400000ULL
+
+static TrafficHost hosts[TRAFFIC_HOSTS];
+static int host_count = 0;
+static uint32_t untracked = 0;
+
+// Host part of url, without scheme, port or path
+static void split_url(const char *url, const char **host, size_t *host_len, const char **rest) {
+  const char *scheme = strstr(url, "://");
+  const char *p = scheme ? scheme + 3 : url;
+  *host = p;
+  while (*p && *p != '/' && *p != ':' && *p != '?') p++;
+  *host_len = p - *host;
+  *rest = p;
+}
+
+static TrafficHost *find_host(const char *host, size_t len) {
+  if (len >= TRAFFIC_HOST_MAX) len = TRAFFIC_HOST_MAX - 1;
+  for (int i = 0; i < host_count; i++) {
+    if (strncmp(hosts[i].host, host, len) == 0 && hosts[i].host[len] == '\0') return &hosts[i];
+  }
+  if (host_count == TRAFFIC_HOSTS) return nullptr;
+
+  TrafficHost *h = &hosts[host_count++];
+  memset(h, 0, sizeof(*h));
+  memcpy(h->host, host, len);
+  return h;
+}
+
+void traffic_record(const char *url, uint32_t bytes_out, uint32_t bytes_in, bool ok) {
+  const char *host, *rest;
+  size_t host_len;
+  split_url(url, &host, &host_len, &rest);
+
+  TrafficHost *h = find_host(host, host_len);
+  if (!h) {
+    untracked++;
+    return;
+  }
+  h->requests++;
+  if (!ok) h->failures++;
+  if (strncmp(url, "https://", 8) == 0) h->tls_handshakes++;
+  h->bytes_out += bytes_out;
+  h->bytes_in += bytes_in;
+}
+
+int traffic_hosts(const TrafficHost **out) {
+  *out = hosts;
+  return host_count;
+}
+
+uint32_t traffic_untracked() {
+  return untracked;
+}
+
+void traffic_clear() {
+  host_count = 0;
+  untracked = 0;
+}
+
+uint32_t traffic_request_bytes(const char *url) {
+  const char *host, *rest;
+  size_t host_len;
+  split_url(url, &host, &host_len, &rest);
+
+  // "GET <path> HTTP/1.0\r\nHost: <host>[:<port>]\r\nUser-Agent: ESP32HTTPClient\r\nConnection: close\r\n\r\n"
+  size_t port_len = 0;
+  const char *path = rest;
+  if (*rest == ':') {
+    path = rest + 1;
+    while (*path >= '0' && *path <= '9') path++;
+    // HTTPClient leaves the default ports out of the Host header
+    size_t n = path - rest;
+    bool default_port = (n == 3 && strncmp(rest, ":80", 3) == 0) || (n == 4 && strncmp(rest, ":443", 4) == 0);
+    if (!default_port) port_len = n;
+  }
+  size_t path_len = *path ? strlen(path) : 1;
+  return 4 + path_len + 11 + 6 + host_len + port_len + 2 + 29 + 19 + 2;
+}
+
+static uint64_t per_day(uint64_t value, uint32_t elapsed_ms) {
+  return elapsed_ms ? value * DAY_MS / elapsed_ms : value;
+}
+
+static void append_row(StrBuilder &out, const char *name, const TrafficHost &h,
+                       uint32_t elapsed_ms) {
+  uint64_t out_tenths = per_day(h.bytes_out, elapsed_ms) * 10 / 1024;
+  uint64_t in_tenths = per_day(h.bytes_in, elapsed_ms) * 10 / 1024;
+  out.addf("%-24s %9lu %9lu %7lu %8lu.%lu %8lu.%lu\n", name,
+           (unsigned long)per_day(h.requests, elapsed_ms), (unsigned long)per_day(h.tls_handshakes, elapsed_ms),
+           (unsigned long)per_day(h.failures, elapsed_ms), (unsigned long)(out_tenths / 10),
+           (unsigned long)(out_tenths % 10), (unsigned long)(in_tenths / 10), (unsigned long)(in_tenths % 10));
+}
+
+size_t traffic_format(char *buf, size_t size, uint32_t elapsed_ms) {
+  StrBuilder out(buf, size);
+
+  out.addf("Per day, from %lu.%lu h:\n", (unsigned long)(elapsed_ms / 3600000),
+           (unsigned long)(elapsed_ms / 360000 % 10));
+  out.addf("%-24s %9s %9s %7s %10s %10s\n", "host", "requests", "tls", "failed", "out KB", "in KB");
+
+  TrafficHost total = {};
+  for (int i = 0; i < host_count; i++) {
+    append_row(out, hosts[i].host, hosts[i], elapsed_ms);
+    total.requests += hosts[i].requests;
+    total.failures += hosts[i].failures;
+    total.tls_handshakes += hosts[i].tls_handshakes;
+    total.bytes_out += hosts[i].bytes_out;
+    total.bytes_in += hosts[i].bytes_in;
+  }
+  append_row(out, "total", total, elapsed_ms);
+  if (untracked) {
+    out.addf("%lu requests to further hosts not tracked\n",
+             (unsigned long)per_day(untracked, elapsed_ms));
+  }
+  return out.length();
+}